@@ -1,30 +1,52 @@
 # target definitions
 
-if(GITHUB_ACTIONS)
-    message("NOTE: GITHUB_ACTIONS defined")
-    target_compile_definitions(${PROJECT_NAME} PRIVATE GITHUB_ACTIONS)
-endif()
+# custom compiler flags
+message("Compiler: ${CMAKE_CXX_COMPILER_ID} version ${CMAKE_CXX_COMPILER_VERSION}")
 
-###############################################################################
+include(cmake/CustomStdlibAndSanitizers.cmake)
 
-if(PROJECT_WARNINGS_AS_ERRORS)
-    set_property(TARGET ${PROJECT_NAME} PROPERTY COMPILE_WARNING_AS_ERROR ON)
-endif()
+function(set_project_compile_flags target)
+    if(GITHUB_ACTIONS)
+        target_compile_definitions(${target} PRIVATE GITHUB_ACTIONS)
+    endif()
 
-# custom compiler flags
-message("Compiler: ${CMAKE_CXX_COMPILER_ID} version ${CMAKE_CXX_COMPILER_VERSION}")
-if(MSVC)
-    target_compile_options(${PROJECT_NAME} PRIVATE /W4 /permissive- /wd4244 /wd4267 /wd4996 /external:anglebrackets /external:W0 /utf-8 /MP)
-else()
-    target_compile_options(${PROJECT_NAME} PRIVATE -Wall -Wextra -pedantic)
+    if(PROJECT_WARNINGS_AS_ERRORS)
+        set_property(TARGET ${target} PROPERTY COMPILE_WARNING_AS_ERROR ON)
+    endif()
+
+    if(MSVC)
+        target_compile_options(${target} PRIVATE /W4 /permissive- /wd4244 /wd4267 /wd4996 /external:anglebrackets /external:W0 /utf-8 /MP)
+    else()
+        target_compile_options(${target} PRIVATE -Wall -Wextra -pedantic)
+    endif()
+
+    if(ENABLE_AVX2)
+        if(MSVC)
+            target_compile_options(${target} PRIVATE /arch:AVX2)
+        else()
+            target_compile_options(${target} PRIVATE -mavx2)
+        endif()
+    endif()
+
+    if(ENABLE_PROFILER)
+        target_compile_definitions(${target} PRIVATE ENABLE_PROFILER)
+    endif()
+
+    if(NOT ENABLE_COUNTRY_ARENA)
+        target_compile_definitions(${target} PRIVATE NO_COUNTRY_ARENA)
+    endif()
+
+    set_custom_stdlib_and_sanitizers(${target} true)
+endfunction()
+
+if(GITHUB_ACTIONS)
+    message("NOTE: GITHUB_ACTIONS defined")
 endif()
 
 ###############################################################################
 
 # sanitizers
 
-include(cmake/CustomStdlibAndSanitizers.cmake)
-
 if("${CMAKE_CXX_COMPILER_ID}" MATCHES "GNU")
 else()
     set_custom_stdlib_and_sanitizers(sfml-system false)
@@ -33,4 +55,8 @@ else()
     set_custom_stdlib_and_sanitizers(sfml-audio false)
 endif()
 
-set_custom_stdlib_and_sanitizers(${PROJECT_NAME} true)
+set_project_compile_flags(${PROJECT_NAME})
+set_project_compile_flags(${PROJECT_NAME}_headless)
+set_project_compile_flags(${PROJECT_NAME}_bench)
+set_project_compile_flags(${PROJECT_NAME}_sweep)
+set_project_compile_flags(${PROJECT_NAME}_alloc_test)
@@ -1,6 +1,9 @@
 option(PROJECT_WARNINGS_AS_ERRORS "Treat warnings as errors" OFF)
 option(USE_ASAN "Use Address Sanitizer" OFF)
 option(USE_MSAN "Use Memory Sanitizer" OFF)
+option(ENABLE_AVX2 "Compile the simulation kernels with AVX2 (otherwise SSE2/scalar)" OFF)
+option(ENABLE_PROFILER "Compile the PROFILE_SCOPE phase timers (dumped to stderr on exit)" OFF)
+option(ENABLE_COUNTRY_ARENA "Allocate each country's containers from its own std::pmr arena" ON)
 option(CMAKE_COLOR_DIAGNOSTICS "Enable color diagnostics" ON)
 option(BUILD_SHARED_LIBS "Build SFML as shared library" FALSE)
 
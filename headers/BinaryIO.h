@@ -0,0 +1,95 @@
+#ifndef BINARY_IO_H
+#define BINARY_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "GameExceptions.h"
+
+// Serializare binara compacta: valorile sunt copiate (memcpy) intr-un buffer in memorie,
+// iar fisierul se scrie / citeste dintr-o singura operatie. Ordinea octetilor este cea nativa;
+// formatele care folosesc aceste clase isi scriu un marker de endianness in header.
+class BinaryWriter {
+    std::vector<char> buffer;
+
+public:
+    template<typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto *bytes = reinterpret_cast<const char *>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    template<typename T>
+    void writeArray(const T *data, std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto *bytes = reinterpret_cast<const char *>(data);
+        buffer.insert(buffer.end(), bytes, bytes + count * sizeof(T));
+    }
+
+    void writeString(const std::string &s) {
+        write(static_cast<std::uint32_t>(s.size()));
+        buffer.insert(buffer.end(), s.begin(), s.end());
+    }
+
+    const std::vector<char> &data() const { return buffer; }
+
+    void saveToFile(const std::string &path) const;
+};
+
+class BinaryReader {
+    const char *cur;
+    const char *end;
+
+    void require(std::size_t bytes) const {
+        if (static_cast<std::size_t>(end - cur) < bytes) throw SnapshotException("Fisier binar trunchiat");
+    }
+
+public:
+    BinaryReader(const char *begin, std::size_t size) : cur(begin), end(begin + size) {
+    }
+
+    template<typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, cur, sizeof(T));
+        cur += sizeof(T);
+        return value;
+    }
+
+    template<typename T>
+    void readArray(T *out, std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        require(count * sizeof(T));
+        std::memcpy(out, cur, count * sizeof(T));
+        cur += count * sizeof(T);
+    }
+
+    std::string readString() {
+        auto size = read<std::uint32_t>();
+        require(size);
+        std::string s(cur, size);
+        cur += size;
+        return s;
+    }
+
+    // intoarce un pointer direct in datele sursa (fara copiere) si avanseaza peste `bytes` octeti
+    const char *take(std::size_t bytes) {
+        require(bytes);
+        const char *p = cur;
+        cur += bytes;
+        return p;
+    }
+
+    std::size_t remaining() const { return static_cast<std::size_t>(end - cur); }
+
+    static std::vector<char> loadFile(const std::string &path);
+};
+
+#endif // BINARY_IO_H
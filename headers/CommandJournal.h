@@ -0,0 +1,64 @@
+#ifndef COMMAND_JOURNAL_H
+#define COMMAND_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EngineCommand.h"
+
+class Engine;
+
+// o comanda si ziua in care a fost aplicata (dupa simularea zilei respective)
+struct JournalEntry {
+    std::int32_t day;
+    EngineCommand command;
+};
+
+// Jurnalul comenzilor unei sesiuni. Engine::execute adauga fiecare comanda acceptata (cele refuzate nu
+// modifica starea, deci nu sunt inregistrate), cu ziua curenta, in jurnalul
+// atasat (Engine::setJournal). Simularea fiind determinista, scenariul, seed-ul si comenzile ajung pentru
+// a reface exact sesiunea: replay() avanseaza pana la ziua fiecarei comenzi, o aplica si continua pana
+// la ziua finala.
+//
+// Formatul fisierului (ordinea nativa a octetilor): char[8] "OOPJRNL", u32 versiune, u32 0x01020304,
+// u64 seed, u32 + octeti scenariu, i32 ziua de start, i32 ziua finala, u32 numarul de comenzi, apoi pentru
+// fiecare comanda: i32 zi, u8 tip, i32 tara, i32 arg0, i32 arg1, i32 arg2 (21 de octeti).
+class CommandJournal {
+    std::string scenario;
+    std::uint64_t seed;
+    int startDay;
+    int endDay;
+    std::vector<JournalEntry> entries;
+
+    static CommandJournal parse(const std::string &path);
+
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    // `scenario` si `seed` sunt cele cu care a fost construit Engine-ul; inregistrarea incepe la `startDay`
+    CommandJournal(std::string scenario, std::uint64_t seed, int startDay = 0);
+
+    void record(int day, const EngineCommand &command);
+
+    // ziua la care s-a incheiat sesiunea (replay() simuleaza pana la ea)
+    void setEndDay(int day);
+
+    const std::string &getScenario() const { return scenario; }
+    std::uint64_t getSeed() const { return seed; }
+    int getStartDay() const { return startDay; }
+    int getEndDay() const { return endDay; }
+    const std::vector<JournalEntry> &getEntries() const { return entries; }
+
+    void save(const std::string &path) const;
+
+    static CommandJournal load(const std::string &path);
+
+    // Aplica jurnalul pe un Engine construit din getScenario() / getSeed() si aflat la getStartDay().
+    // Intoarce cate comenzi au fost respinse (GameException) si ignorate; pentru un jurnal reluat cu
+    // aceiasi parametri ca sesiunea originala numarul este 0.
+    std::size_t replay(Engine &engine) const;
+};
+
+#endif // COMMAND_JOURNAL_H
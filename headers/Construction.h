@@ -1,6 +1,7 @@
 #ifndef CONSTRUCTION_H
 #define CONSTRUCTION_H
 
+#include <cstddef>
 #include <string>
 
 enum class BuildingType {
@@ -15,6 +16,8 @@ enum class BuildingType {
     NuclearRF
 };
 
+constexpr std::size_t BUILDING_TYPE_COUNT = 9;
+
 class Construction {
     BuildingType type;
     int provinceIndex;
@@ -24,6 +27,8 @@ class Construction {
 public:
     Construction(BuildingType type, int provinceIndex, double totalCost);
 
+    Construction(BuildingType type, int provinceIndex, double totalCost, double remainingBP);
+
     bool progress(double dailyBP);
 
     BuildingType getType() const;
@@ -0,0 +1,42 @@
+#ifndef COUNTER_RNG_H
+#define COUNTER_RNG_H
+
+#include <cstdint>
+
+// Generator aleator "counter-based" (SplitMix64): fiecare valoare este o functie pura de
+// (seed, zi, flux, contor), fara stare interna. Doua tari (fluxuri diferite) nu isi consuma
+// reciproc numerele, ordinea in care sunt simulate nu conteaza, iar o zi poate fi re-simulata
+// (replay) obtinand exact aceleasi valori.
+class CounterRng {
+    std::uint64_t seed = 0;
+    std::uint32_t stream = 0;
+
+    static constexpr std::uint64_t mix(std::uint64_t z) {
+        z += 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+public:
+    constexpr CounterRng() = default;
+
+    constexpr CounterRng(std::uint64_t seed, std::uint32_t stream) : seed(seed), stream(stream) {
+    }
+
+    // valoarea numarul `counter` din ziua `day` a fluxului
+    constexpr std::uint64_t at(std::int64_t day, std::uint32_t counter = 0) const {
+        std::uint64_t key = mix(seed ^ mix(static_cast<std::uint64_t>(day)));
+        return mix(key ^ (static_cast<std::uint64_t>(stream) << 32 | counter));
+    }
+
+    // intreg uniform in [0, bound) (bound > 0), prin inmultire pe 64 de biti in loc de modulo
+    constexpr std::uint32_t below(std::uint32_t bound, std::int64_t day, std::uint32_t counter = 0) const {
+        return static_cast<std::uint32_t>(((at(day, counter) >> 32) * bound) >> 32);
+    }
+
+    constexpr std::uint64_t getSeed() const { return seed; }
+    constexpr std::uint32_t getStream() const { return stream; }
+};
+
+#endif // COUNTER_RNG_H
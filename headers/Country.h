@@ -1,6 +1,10 @@
 #ifndef COUNTRY_H
 #define COUNTRY_H
 
+#include <array>
+#include <climits>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <ostream>
@@ -8,24 +12,68 @@
 #include "Province.h"
 #include "ResourceStockpile.h"
 #include "EquipmentStockpile.h"
-#include "ProductionLine.h"
+#include "ProductionLines.h"
 #include "Construction.h"
 #include "FocusTree.h"
 #include "ProductionQueue.h"
+#include "ProvinceStats.h"
+#include "CounterRng.h"
+#include "SimulationParams.h"
+
+enum class CountryEventKind { None, Construction, Focus };
+
+struct CountryEvent {
+    int days;
+    CountryEventKind kind;
+};
+
+// Arena de memorie a unei tari: un pool (reutilizeaza blocurile eliberate, de ex. de coada de constructii)
+// peste un buffer monoton care cere memorie in blocuri mari. Este folosita dintr-un singur thread la un
+// moment dat (tara care o detine), deci nu are sincronizare, iar memoria este eliberata toata odata.
+struct CountryArena {
+    std::pmr::monotonic_buffer_resource blocks;
+    std::pmr::unsynchronized_pool_resource pool{&blocks};
+};
 
 class Country {
+    // declarat primul, deci distrus ultimul: containerele de mai jos aloca din el.
+    // Este partajat (shared_ptr) pentru ca un obiect mutat poate pastra memorie din arena (de ex. harta goala
+    // a unui std::deque) si trebuie sa o poata elibera si dupa ce tara noua a fost distrusa.
+    std::shared_ptr<CountryArena> arena;
     std::string name;
     std::string ideology;
-    std::vector<Province> provinces;
+    std::pmr::vector<Province> provinces;
+    ProvinceStatColumns provinceStats;
     ResourceStockpile resources;
     EquipmentStockpile equipment;
-    std::vector<ProductionLine> milLines;
+    ProductionLines milLines;
+    int usedMilFactories = 0;
     ProductionQueue<Construction> constructions;
+    // numarul de constructii din coada pentru fiecare (provincie, BuildingType), mentinut la add/remove
+    std::pmr::vector<std::array<int, BUILDING_TYPE_COUNT> > queuedCounts;
+    double constructionSlotCap = SimulationParams{}.constructionSlotCap();
     FocusTree focusTree;
+    // fluxul aleator al tarii, indexat dupa ziua simulata (elapsedDays)
+    CounterRng rng;
+    int elapsedDays = 0;
+    // constantele de echilibru, copiate (nu partajate), deci tarile din Engine-uri diferite nu impart stare
+    SimulationParams params;
+
+    static std::shared_ptr<CountryArena> makeArena();
+
+    std::pmr::memory_resource *memory() const;
+
+    void refreshProvinceStats(int provinceIndex);
 
-    static constexpr int MIL_OUTPUT = 1000;
-    static constexpr int OIL_TO_FUEL = 5;
-    static constexpr double CIV_OUTPUT_PER_DAY = 5.0;
+    void completeConstruction(const Construction &c);
+
+    void progressConstructions(double dailyBP);
+
+    long long dailyFuelOutput() const;
+
+    int builtCount(int provinceIndex, BuildingType type) const;
+
+    void checkAggregates() const;
 
 public:
     Country(std::string n, std::string id, std::vector<Province> p, ResourceStockpile r);
@@ -34,6 +82,11 @@ public:
 
     Country &operator=(const Country &other);
 
+    // mutarea nu copiaza provinciile; folosita la cresterea std::vector<Country> si la construirea scenariilor
+    Country(Country &&other) noexcept;
+
+    Country &operator=(Country &&other) noexcept;
+
     ~Country() = default;
 
     int totalCiv() const;
@@ -50,6 +103,11 @@ public:
 
     int totalChromium() const;
 
+    const ProvinceTotals &provinceTotals() const;
+
+    // creste la fiecare modificare a provinciei (constructie finalizata, efect de focus)
+    std::uint32_t getProvinceVersion(int provinceIndex) const;
+
     int getUsedMilFactories() const;
 
     int getFreeMilFactories() const;
@@ -60,20 +118,50 @@ public:
 
     void addProductionLine(EquipmentType t);
 
-    bool startFocus(int index);
+    FocusStartResult startFocus(int index);
 
     void addConstruction(BuildingType type, int provinceIndex, int count = 1);
 
+    int getQueuedCount(int provinceIndex, BuildingType type) const;
+
+    void setConstructionSlotCap(double bpPerDay);
+
+    double getConstructionSlotCap() const { return constructionSlotCap; }
+
+    // inlocuieste constantele de echilibru; reseteaza plafonul de slot si duratele focus-urilor
+    void setParams(const SimulationParams &p);
+
+    const SimulationParams &getParams() const { return params; }
+
+    void seedRandom(std::uint64_t seed, std::uint32_t countryIndex);
+
+    int getElapsedDays() const { return elapsedDays; }
+
     void simulateDay();
 
+    // valoare intoarsa de daysUntilNextEvent() cand nu exista niciun eveniment programat
+    static constexpr int NO_EVENT = INT_MAX;
+
+    CountryEvent nextEvent() const;
+
+    int daysUntilNextEvent() const { return nextEvent().days; }
+
+    void fastForward(int days);
+
     std::string toString() const;
 
+    void save(BinaryWriter &out) const;
+
+    static Country load(BinaryReader &in);
+
     const std::string &getName() const { return name; }
-    const std::vector<Province> &getProvinces() const { return provinces; }
+    const std::string &getIdeology() const { return ideology; }
+    const std::pmr::vector<Province> &getProvinces() const { return provinces; }
     const ResourceStockpile &getResourceStockpile() const { return resources; }
     const FocusTree &getFocusTree() const { return focusTree; }
     const ProductionQueue<Construction> &getConstructionQueue() const { return constructions; }
-    const std::vector<ProductionLine> &getProductionLines() const { return milLines; }
+    const ProductionLines &getProductionLines() const { return milLines; }
+    const EquipmentStockpile &getEquipment() const { return equipment; }
 };
 
 std::ostream &operator<<(std::ostream &os, const Country &c);
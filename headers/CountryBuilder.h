@@ -3,6 +3,7 @@
 
 #include "Country.h"
 #include <string>
+#include <utility>
 #include <vector>
 
 
@@ -16,13 +17,13 @@ public:
     CountryBuilder() : resources(0, 0) {
     }
 
-    CountryBuilder &setName(const std::string &n) {
-        name = n;
+    CountryBuilder &setName(std::string n) {
+        name = std::move(n);
         return *this;
     }
 
-    CountryBuilder &setIdeology(const std::string &id) {
-        ideology = id;
+    CountryBuilder &setIdeology(std::string id) {
+        ideology = std::move(id);
         return *this;
     }
 
@@ -31,15 +32,37 @@ public:
         return *this;
     }
 
+    CountryBuilder &reserveProvinces(std::size_t count) {
+        provinces.reserve(count);
+        return *this;
+    }
+
     CountryBuilder &addProvince(const Province &p) {
         provinces.push_back(p);
         return *this;
     }
 
+    CountryBuilder &addProvince(Province &&p) {
+        provinces.push_back(std::move(p));
+        return *this;
+    }
+
+    // construieste provincia direct in vectorul builder-ului, cu aceiasi parametri ca Province(...)
+    template<typename... Args>
+    CountryBuilder &emplaceProvince(Args &&... args) {
+        provinces.emplace_back(std::forward<Args>(args)...);
+        return *this;
+    }
 
-    Country build() {
+    // builder-ul ramane utilizabil, deci provinciile sunt copiate
+    Country build() const & {
         return Country(name, ideology, provinces, resources);
     }
+
+    // std::move(builder).build(): provinciile si numele sunt mutate in Country, fara copii
+    Country build() && {
+        return Country(std::move(name), std::move(ideology), std::move(provinces), resources);
+    }
 };
 
 #endif // COUNTRY_BUILDER_H
@@ -1,28 +1,151 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <vector>
 #include "Country.h"
+#include "EngineCommand.h"
+#include "EventScheduler.h"
+#include "SimulationParams.h"
+#include "TelemetryWriter.h"
+#include "ThreadPool.h"
+
+// Engine-ul nu mai parcurge toate tarile in fiecare zi: fiecare tara are in `scheduler` ziua urmatorului
+// ei eveniment (constructie sau focus finalizat), iar intre evenimente ramane in urma (syncedDay) si este
+// adusa la zi analitic (Country::fastForward) doar cand este citita, modificata sau are un eveniment.
+// Din acest motiv toate modificarile trec prin Engine::execute, care sincronizeaza si reprogrameaza tara
+// (si inregistreaza comanda acceptata in jurnalul atasat, daca exista).
+class CommandJournal;
 
 class Engine {
     std::vector<Country> countries;
+    std::vector<int> syncedDay;
+    // creste la fiecare schimbare a starii unei tari (zi simulata, comanda), ca interfata sa poata
+    // reimprospata doar tarile modificate de la ultimul cadru
+    std::vector<std::uint64_t> countryVersions;
+    EventScheduler scheduler;
     int day = 0;
+    std::string scenarioName;
+    std::uint64_t seed;
+    SimulationParams params;
+    std::unique_ptr<ThreadPool> pool;
+    // nullptr = fara telemetrie; altfel primeste cate un rand pe tara dupa fiecare zi
+    TelemetryWriter *telemetry = nullptr;
+    std::vector<TelemetryRecord> telemetryRows;
+    // nullptr = comenzile nu sunt inregistrate
+    CommandJournal *journal = nullptr;
+    // starea vine dintr-un snapshot, nu din scenarioName, deci un jurnal nu ar putea fi reluat
+    bool loadedFromSnapshot = false;
 
 public:
     Engine();
 
+    static constexpr std::uint64_t DEFAULT_SEED = 0x5EED;
+
+    // acelasi scenariu, seed si parametri si aceleasi comenzi dau mereu aceeasi simulare.
+    // `params` se aplica tuturor tarilor; arunca GameException daca nu trec SimulationParams::validate.
+    explicit Engine(const std::string &scenario, std::uint64_t seed = DEFAULT_SEED,
+                    const SimulationParams &params = {});
+
     Engine(const Engine &) = delete;
 
     Engine &operator=(const Engine &) = delete;
 
     void simulateOneDay();
 
-    const std::vector<Country> &getCountries() const { return countries; }
-    std::vector<Country> &getMutableCountries() { return countries; }
+    void simulateDays(int days);
+
+    void advance(int days);
+
+    // numarul de thread-uri folosite pentru a simula tarile in paralel (1 = serial, 0 = toate nucleele)
+    void setWorkerCount(unsigned workers);
+
+    unsigned getWorkerCount() const { return pool ? pool->concurrency() : 1; }
+
+    // Cu telemetria activa fiecare zi aduce toate tarile la zi si scrie starea lor, deci advance()
+    // nu mai sare peste zilele fara evenimente. Writer-ul trebuie sa traiasca pana la setTelemetry(nullptr).
+    void setTelemetry(TelemetryWriter *writer) { telemetry = writer; }
+
+    // singura cale prin care starea tarilor este modificata dupa construire; o comanda refuzata (focus
+    // respins, limita de cladiri atinsa, argumente invalide) arunca GameException cu motivul refuzului
+    void execute(const EngineCommand &command);
+
+    // comenzile aplicate de acum inainte sunt adaugate in `target` (nullptr opreste inregistrarea);
+    // jurnalul trebuie sa traiasca pana la setJournal(nullptr). Jurnalul retine doar scenariul si seed-ul,
+    // deci inregistrarea este refuzata (JournalException) dupa loadSnapshot, iar loadSnapshot in timpul ei.
+    void setJournal(CommandJournal *target);
+
+    // snapshot binar al intregii stari (ziua, seed-ul si toate tarile); formatul este versionat
+    static constexpr std::uint32_t SNAPSHOT_VERSION = 3;
+
+    void saveSnapshot(const std::string &path);
+
+    void loadSnapshot(const std::string &path);
+
+    // scrie tarile curente ca fisier de scenariu, incarcabil ulterior prin Engine(cale)
+    void exportScenario(const std::string &path);
+
+    // aduce toate tarile la ziua curenta inainte de a le expune
+    const std::vector<Country> &getCountries();
+
+    const Country &getCountry(int countryIndex);
+
+    // versiunea starii unei tari (o aduce la zi, ca si getCountry); o valoare neschimbata intre
+    // doua citiri inseamna ca nimic din tara nu s-a modificat
+    std::uint64_t getCountryVersion(int countryIndex);
+
+    // starea unei tari asa cum a lasat-o ultima sincronizare (ziua getSyncedDay), fara a o aduce la zi;
+    // versiunea nu se schimba cat timp tara nu are evenimente si nu este citita prin getCountry
+    const Country &peekCountry(int countryIndex) const;
+
+    std::uint64_t peekCountryVersion(int countryIndex) const;
+
+    int getSyncedDay(int countryIndex) const;
+
+    // versiunea unei provincii: se schimba doar cand provincia insasi este modificata
+    std::uint32_t getProvinceVersion(int countryIndex, int provinceIndex);
+
     int getDay() const { return day; }
+    std::size_t getCountryCount() const { return countries.size(); }
+    std::uint64_t getSeed() const { return seed; }
+    // numele scenariului din constructor (starea poate fi inlocuita ulterior de loadSnapshot, vezi isFromSnapshot)
+    const std::string &getScenario() const { return scenarioName; }
+    bool isFromSnapshot() const { return loadedFromSnapshot; }
+    // parametrii din constructor; nu sunt salvati in snapshot-uri sau jurnale, deci o reluare trebuie
+    // construita cu aceiasi parametri
+    const SimulationParams &getParams() const { return params; }
 
 private:
     void init();
+
+    void loadScenario(const std::string &scenario);
+
+    void seedCountries();
+
+    void resetSchedule();
+
+    void syncCountry(int countryIndex);
+
+    void reschedule(int countryIndex);
+
+    void processDueEvents();
+
+    void recordTelemetry();
+
+    // aplica o comanda fara a o inregistra; arunca GameException daca este refuzata
+    void dispatch(const EngineCommand &command);
+
+    void startFocus(int countryIndex, int focusIndex);
+
+    void addConstruction(int countryIndex, BuildingType type, int provinceIndex, int count);
+
+    void addProductionLine(int countryIndex, EquipmentType type);
+
+    void modifyLineFactories(int countryIndex, int lineIndex, int amount);
+
+    Country &mutableCountry(int countryIndex);
 };
 
 #endif
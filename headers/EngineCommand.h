@@ -0,0 +1,46 @@
+#ifndef ENGINE_COMMAND_H
+#define ENGINE_COMMAND_H
+
+#include <cstdint>
+
+#include "Construction.h"
+#include "ProductionLine.h"
+
+enum class CommandType : std::uint8_t {
+    StartFocus,
+    AddConstruction,
+    AddProductionLine,
+    ModifyLineFactories
+};
+
+// O actiune a jucatorului, ca valoare: poate fi pusa intr-o coada si aplicata mai tarziu (Engine::execute)
+// pe thread-ul simularii. Sensul argumentelor depinde de tip:
+//  - StartFocus:          arg0 = indexul focus-ului
+//  - AddConstruction:     arg0 = BuildingType, arg1 = provincia, arg2 = numarul de cladiri
+//  - AddProductionLine:   arg0 = EquipmentType
+//  - ModifyLineFactories: arg0 = indexul liniei, arg1 = diferenta de fabrici
+struct EngineCommand {
+    CommandType type;
+    std::int32_t country;
+    std::int32_t arg0 = 0;
+    std::int32_t arg1 = 0;
+    std::int32_t arg2 = 0;
+
+    static EngineCommand startFocus(int country, int focusIndex) {
+        return {CommandType::StartFocus, country, focusIndex};
+    }
+
+    static EngineCommand addConstruction(int country, BuildingType type, int provinceIndex, int count = 1) {
+        return {CommandType::AddConstruction, country, static_cast<std::int32_t>(type), provinceIndex, count};
+    }
+
+    static EngineCommand addProductionLine(int country, EquipmentType type) {
+        return {CommandType::AddProductionLine, country, static_cast<std::int32_t>(type)};
+    }
+
+    static EngineCommand modifyLineFactories(int country, int lineIndex, int amount) {
+        return {CommandType::ModifyLineFactories, country, lineIndex, amount};
+    }
+};
+
+#endif // ENGINE_COMMAND_H
@@ -0,0 +1,49 @@
+#ifndef EQUIPMENT_CATALOG_H
+#define EQUIPMENT_CATALOG_H
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+enum class EquipmentType { Gun, Artillery, AntiAir, CAS };
+
+struct EquipmentInfo {
+    EquipmentType type;
+    // eticheta din Country::toString / EquipmentStockpile::toString
+    std::string_view shortName;
+    // numele afisat in interfata
+    std::string_view displayName;
+    // cost de productie al unei unitati, in miimi de IC (intreg, ca productia acumulata sa fie exacta)
+    int unitCostMilli;
+};
+
+// Catalogul echipamentelor, indexat dupa EquipmentType. Un tip nou se adauga in enum si aici;
+// productia, stocurile si validarile folosesc doar tabela (snapshot-urile si scenariile au insa
+// un numar fix de coloane, deci formatul lor trebuie versionat odata cu tabela).
+inline constexpr std::array<EquipmentInfo, 4> EQUIPMENT_CATALOG{{
+    {EquipmentType::Gun, "Guns", "Infantry Eq.", 500},
+    {EquipmentType::Artillery, "Artillery", "Artillery", 3500},
+    {EquipmentType::AntiAir, "AA", "Anti-Air", 4000},
+    {EquipmentType::CAS, "CAS", "CAS", 12000},
+}};
+
+inline constexpr std::size_t EQUIPMENT_TYPE_COUNT = EQUIPMENT_CATALOG.size();
+
+constexpr bool catalogMatchesEnum() {
+    for (std::size_t i = 0; i < EQUIPMENT_TYPE_COUNT; ++i) {
+        if (static_cast<std::size_t>(EQUIPMENT_CATALOG[i].type) != i) return false;
+    }
+    return true;
+}
+
+static_assert(catalogMatchesEnum(), "EQUIPMENT_CATALOG trebuie sa fie in ordinea lui EquipmentType");
+
+constexpr std::size_t equipmentIndex(EquipmentType t) { return static_cast<std::size_t>(t); }
+
+constexpr const EquipmentInfo &equipmentInfo(EquipmentType t) { return EQUIPMENT_CATALOG[equipmentIndex(t)]; }
+
+constexpr bool isValidEquipmentType(long long raw) {
+    return raw >= 0 && static_cast<unsigned long long>(raw) < EQUIPMENT_TYPE_COUNT;
+}
+
+#endif // EQUIPMENT_CATALOG_H
@@ -1,33 +1,38 @@
 #ifndef EQUIPMENT_STOCKPILE_H
 #define EQUIPMENT_STOCKPILE_H
 
+#include <array>
 #include <string>
 #include <ostream>
 
-class EquipmentStockpile {
-    long long guns = 0;
-    long long artillery = 0;
-    long long antiAir = 0;
-    long long cas = 0;
+#include "EquipmentCatalog.h"
+
+class BinaryWriter;
+class BinaryReader;
 
+// stocul de echipament al unei tari: cate un contor pentru fiecare intrare din EQUIPMENT_CATALOG
+class EquipmentStockpile {
 public:
-    void addGuns(long long n);
+    using Counts = std::array<long long, EQUIPMENT_TYPE_COUNT>;
 
-    void addArtillery(long long n);
+private:
+    Counts counts{};
 
-    void addAntiAir(long long n);
+public:
+    void add(EquipmentType t, long long n);
 
-    void addCAS(long long n);
+    // adauga productia tuturor tipurilor dintr-o data (valorile negative sunt ignorate)
+    void addAll(const Counts &produced);
 
-    long long getGuns() const;
+    long long get(EquipmentType t) const { return counts[equipmentIndex(t)]; }
 
-    long long getArtillery() const;
+    const Counts &getCounts() const { return counts; }
 
-    long long getAntiAir() const;
+    std::string toString() const;
 
-    long long getCAS() const;
+    void save(BinaryWriter &out) const;
 
-    std::string toString() const;
+    void load(BinaryReader &in);
 };
 
 std::ostream &operator<<(std::ostream &os, const EquipmentStockpile &e);
@@ -0,0 +1,48 @@
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "Country.h"
+
+struct ScheduledEvent {
+    long long day;
+    int countryIndex;
+    CountryEventKind kind;
+    std::uint32_t generation;
+};
+
+// Coada de prioritate cu evenimentele viitoare ale tarilor (cel mult unul valid per tara).
+// Reprogramarea unei tari nu scoate vechiul eveniment din heap: il invalideaza prin generatie,
+// iar intrarile invalide sunt aruncate cand ajung in varf.
+class EventScheduler {
+    struct Later {
+        bool operator()(const ScheduledEvent &a, const ScheduledEvent &b) const {
+            if (a.day != b.day) return a.day > b.day;
+            return a.countryIndex > b.countryIndex;
+        }
+    };
+
+    std::priority_queue<ScheduledEvent, std::vector<ScheduledEvent>, Later> queue;
+    std::vector<std::uint32_t> generations;
+
+    void dropStale();
+
+public:
+    static constexpr long long NEVER = (1LL << 62);
+
+    void reset(std::size_t countryCount);
+
+    void schedule(int countryIndex, long long day, CountryEventKind kind);
+
+    void cancel(int countryIndex);
+
+    long long nextDay();
+
+    std::vector<ScheduledEvent> popDue(long long day);
+};
+
+#endif // EVENT_SCHEDULER_H
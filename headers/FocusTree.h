@@ -1,24 +1,37 @@
 #ifndef FOCUS_TREE_H
 #define FOCUS_TREE_H
 
+#include <array>
 #include <string>
-#include <vector>
+#include <string_view>
+
+class BinaryWriter;
+class BinaryReader;
 
 enum class FocusEffectType { AddCiv, AddMil, AddInfra, AddDockyard };
 
+// rezultatul FocusTree::startFocus; simularea nu scrie nimic la consola, apelantul raporteaza refuzul
+enum class FocusStartResult { Started, AlreadyRunning, InvalidIndex, AlreadyCompleted };
+
+// mesajul afisat pentru un refuz (sau "Focus started" pentru Started)
+const char *focusStartMessage(FocusStartResult result);
+
 class Focus {
-    std::string name_;
+    // numele sunt literali din catalogul fix din FocusTree, deci nu trebuie copiate
+    std::string_view name_;
     int daysRequired_;
     FocusEffectType effect_;
     bool completed_ = false;
 
 public:
-    Focus(std::string name, int daysRequired, FocusEffectType effect);
+    Focus(std::string_view name, int daysRequired, FocusEffectType effect);
 
-    const std::string &name() const;
+    std::string_view name() const;
 
     int days() const;
 
+    void setDays(int days);
+
     FocusEffectType effect() const;
 
     void markCompleted();
@@ -28,19 +41,34 @@ public:
 };
 
 class FocusTree {
-    std::vector<Focus> focuses;
+public:
+    static constexpr std::size_t FOCUS_COUNT = 4;
+
+private:
+    std::array<Focus, FOCUS_COUNT> focuses;
     int currentIndex = -1;
     int progress = 0;
 
 public:
     FocusTree();
 
-    bool startFocus(int index);
+    // duratele (zile) focus-urilor, in ordinea din catalog; progresul focus-ului activ se pastreaza
+    void setDurations(const std::array<int, FOCUS_COUNT> &days);
+
+    FocusStartResult startFocus(int index);
 
     std::string getActiveFocusName() const;
 
     int tickRaw();
 
+    int daysRemaining() const;
+
+    void advance(int days);
+
+    void save(BinaryWriter &out) const;
+
+    void load(BinaryReader &in);
+
     // --- MODIFICARE: Getteri UI ---
     int getActiveFocusIndex() const { return currentIndex; }
 
@@ -18,6 +18,34 @@ public:
     }
 };
 
+class SnapshotException : public GameException {
+public:
+    explicit SnapshotException(const std::string &msg)
+        : GameException(msg) {
+    }
+};
+
+class ScenarioException : public GameException {
+public:
+    explicit ScenarioException(const std::string &msg)
+        : GameException(msg) {
+    }
+};
+
+class TelemetryException : public GameException {
+public:
+    explicit TelemetryException(const std::string &msg)
+        : GameException(msg) {
+    }
+};
+
+class JournalException : public GameException {
+public:
+    explicit JournalException(const std::string &msg)
+        : GameException(msg) {
+    }
+};
+
 class InvalidProvinceIndexException : public GameException {
     int invalidIndex;
 
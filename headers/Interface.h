@@ -2,24 +2,40 @@
 #define INTERFACE_H
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include "Engine.h"
+#include "SimulationThread.h"
+#include "TextureAtlas.h"
 
 enum class StatKind {
     Steel, Tungsten, Aluminum, Chromium, Oil,
     Civ, Mil, Infra, Dockyard, Airfield
 };
 
+// regiunile atlasului de iconite; primele intrari au aceeasi ordine ca StatKind
+enum class AtlasIcon {
+    Steel, Tungsten, Aluminum, Chromium, Oil,
+    Civ, Mil, Infra, Dockyard, Airfield,
+    Manpower, FuelStock, Gun, Artillery, AntiAir, CAS, Plus, Minus
+};
+
+// iconita unei statistici de provincie; este desenata ca quad in lotul comun al provinciilor
 struct ResourceIconUI {
     StatKind kind;
-    sf::Sprite icon;
-    sf::Text value;
+    sf::Vector2f position;
+    std::string value;
+    sf::Color color;
     int lastValue;
 };
 
 struct ProvinceUI {
     std::vector<ResourceIconUI> resourceIcons;
+    // versiunea provinciei (Engine::getProvinceVersion) afisata ultima data
+    std::uint32_t shownVersion = 0;
+    // are valori colorate (verde/rosu) care trebuie readuse la alb la urmatoarea reimprospatare
+    bool highlighted = false;
 };
 
 struct ClickZone {
@@ -28,7 +44,10 @@ struct ClickZone {
 };
 
 class Interface {
-    Engine &engine;
+    // simularea ruleaza pe thread-ul ei; interfata citeste doar snapshot-uri si trimite comenzi
+    SimulationThread simulation;
+    // snapshot-ul folosit in cadrul curent (preluat o data la inceputul fiecarui cadru)
+    std::shared_ptr<const WorldSnapshot> snapshot;
     sf::RenderWindow window;
 
     sf::Texture mapTexture;
@@ -38,9 +57,20 @@ class Interface {
     sf::Text infoText;
     sf::Text alertText;
 
-    sf::Texture steelTex, tungstenTex, aluminumTex, chromiumTex, oilTex;
-    sf::Texture civTex, milTex, infraTex, dockyardTex, airfieldTex;
-    sf::Texture manpowerTex, fuelStockTex;
+    TextureAtlas atlas;
+    // quad-urile iconitelor si glifele valorilor tuturor provinciilor, reconstruite la fiecare cadru
+    sf::VertexArray iconBatch{sf::Triangles};
+    sf::VertexArray glyphBatch{sf::Triangles};
+    int batchCountryIndex = -1;
+    bool provinceBatchDirty = true;
+
+    // starea afisata ultima data; updateUI reimprospateaza doar ce s-a schimbat fata de ea
+    int shownCountryIndex = -1;
+    std::uint64_t shownCountryVersion = 0;
+    int shownDay = -1;
+    // starea simularii (pornita / oprita) ceruta ultima data; la schimbare eticheta zilei este refacuta
+    bool shownRunning = false;
+    bool dayTextDirty = true;
 
     sf::Sprite roFuelSprite, roManpowerSprite;
     sf::Sprite huFuelSprite, huManpowerSprite;
@@ -66,8 +96,6 @@ class Interface {
     sf::Text queueTitleText;
 
     bool showProduction = false;
-    sf::Texture gunTex, artTex, aaTex, casTex;
-    sf::Texture plusTex, minusTex;
     sf::Text prodTitleText;
     sf::Sprite addNewIcons[4];
 
@@ -85,9 +113,18 @@ class Interface {
 
     void setupProductionUI();
 
+    void setAtlasSprite(sf::Sprite &sprite, AtlasIcon icon, float size) const;
+
+    void drawProvinceIcons(std::size_t countryIndex);
+
+    void rebuildProvinceBatch(std::size_t countryIndex);
+
     sf::Vector2f getIconPositionFor(const std::string &countryName, const std::string &provinceName, StatKind kind);
 
 public:
+    // durata reala a unei zile simulate cat timp este selectata o tara
+    static constexpr std::chrono::milliseconds DAY_DURATION{1000};
+
     explicit Interface(Engine &eng, const std::string &title = "Country Manager UI");
 
     void run();
@@ -0,0 +1,31 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+// Fisier mapat read-only in memorie (mmap pe POSIX, MapViewOfFile pe Windows).
+// Continutul poate fi citit direct, fara copiere intr-un buffer intermediar.
+class MappedFile {
+    const char *ptr = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    void *mapping = nullptr;
+#endif
+
+    void release() noexcept;
+
+public:
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    const char *data() const { return ptr; }
+    std::size_t size() const { return length; }
+};
+
+#endif // MAPPED_FILE_H
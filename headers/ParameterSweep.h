@@ -0,0 +1,78 @@
+#ifndef PARAMETER_SWEEP_H
+#define PARAMETER_SWEEP_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Engine.h"
+#include "EquipmentCatalog.h"
+
+// o axa a grilei: un parametru (cheie SimulationParams::set) si valorile incercate
+struct SweepAxis {
+    std::string key;
+    std::vector<std::string> values;
+};
+
+struct SweepConfig {
+    std::string scenario = "default";
+    // grila este produsul cartezian al axelor (fara axe: un singur punct, parametrii impliciti)
+    std::vector<SweepAxis> axes;
+    // pentru un scenariu "synthetic:" fara cheia seed, fiecare seed genereaza alta lume; pentru celelalte
+    // scenarii rezultatul nu depinde de seed, deci este permis un singur seed
+    std::vector<std::uint64_t> seeds{Engine::DEFAULT_SEED};
+    int days = 365;
+    // thread-uri care ruleaza simularile (0 = toate nucleele)
+    unsigned workers = 0;
+};
+
+// Metricile unei rulari, insumate peste toate tarile in ziua `days`: fuel, fabrici civile si militare,
+// apoi stocul fiecarui tip de echipament (in ordinea din EQUIPMENT_CATALOG).
+inline constexpr std::size_t SWEEP_METRIC_COUNT = 3 + EQUIPMENT_TYPE_COUNT;
+
+using SweepMetrics = std::array<double, SWEEP_METRIC_COUNT>;
+
+// distributia unei metrici peste seed-uri; percentilele sunt calculate prin rangul cel mai apropiat
+struct SweepStats {
+    double mean = 0;
+    double min = 0;
+    double p10 = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double max = 0;
+};
+
+struct SweepPoint {
+    // cate o valoare pentru fiecare axa, in ordinea din SweepConfig::axes
+    std::vector<std::string> values;
+    std::array<SweepStats, SWEEP_METRIC_COUNT> stats;
+};
+
+struct SweepResult {
+    std::vector<SweepPoint> points;
+    std::size_t runs = 0;
+    unsigned workers = 1;
+    double seconds = 0;
+};
+
+// Ruleaza cate o simulare pentru fiecare pereche (punct din grila, seed). Fiecare rulare are propriul
+// Engine (serial, cu parametrii punctului), deci rularile nu impart stare modificabila si se impart
+// dinamic intre thread-uri: timpul scade aproape liniar cu numarul de nuclee cat timp sunt mai multe
+// rulari decat thread-uri. Rezultatul nu depinde de numarul de thread-uri.
+namespace ParameterSweep {
+    std::string_view metricName(std::size_t metric);
+
+    // "key=v1,v2,v3"; arunca GameException daca lipseste '=' sau lista de valori
+    SweepAxis parseAxis(const std::string &arg);
+
+    // "1,2,3" sau intervalul inchis "1-100"
+    std::vector<std::uint64_t> parseSeeds(const std::string &arg);
+
+    // arunca GameException pentru chei, valori sau parametri invalizi, inainte de a porni vreo rulare
+    SweepResult run(const SweepConfig &config);
+}
+
+#endif // PARAMETER_SWEEP_H
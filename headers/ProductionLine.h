@@ -1,28 +1,44 @@
 #ifndef PRODUCTIONLINE_H
 #define PRODUCTIONLINE_H
 
-enum class EquipmentType { Gun, Artillery, AntiAir, CAS };
-
+#include "EquipmentCatalog.h"
+
+// Starea unei linii de productie la un moment dat (o "linie" din ProductionLines).
+//
+// Modelul de productie: o fabrica produce MIL_OUTPUT IC pe zi la eficienta maxima (valoarea implicita a
+// SimulationParams::milOutput). Eficienta
+// (in promile) creste cu EFFICIENCY_GROWTH pe zi pana la EFFICIENCY_CAP. Productia este acumulata in
+// `progress` (miimi de IC) si transformata in unitati intregi cand ajunge la costul unei unitati,
+// deci fractiunile nu se pierd de la o zi la alta.
 class ProductionLine {
     EquipmentType type;
     int factories;
-    double efficiency;
-    double unitCost;
+    int efficiency;
+    long long progress;
 
 public:
-    ProductionLine(EquipmentType t, int f, double eff);
+    static constexpr int MIL_OUTPUT = 1000;
+    static constexpr int EFFICIENCY_START = 100;
+    static constexpr int EFFICIENCY_CAP = 1000;
+    static constexpr int EFFICIENCY_GROWTH = 15;
+    // eficienta pierduta cand liniei i se iau fabrici (reorganizarea productiei)
+    static constexpr int RETOOLING_PENALTY = 100;
+
+    ProductionLine(EquipmentType t, int f, int eff = EFFICIENCY_START, long long progress = 0);
 
     EquipmentType getType() const;
 
     int getFactories() const;
 
-    double getEfficiency() const;
+    // eficienta curenta, in promile
+    int getEfficiency() const;
 
     double getUnitCost() const;
 
-    void setFactories(int count);
+    long long getProgress() const;
 
-    long long calculateDailyOutput() const;
+    // unitatile produse azi la eficienta curenta, fara fractiunea acumulata
+    long long calculateDailyOutput(int milOutput = MIL_OUTPUT) const;
 };
 
 #endif
@@ -0,0 +1,93 @@
+#ifndef PRODUCTION_LINES_H
+#define PRODUCTION_LINES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+
+#include "EquipmentStockpile.h"
+#include "ProductionLine.h"
+
+// Liniile de productie ale unei tari, ca "structure of arrays": cate o coloana contigua pentru tip,
+// fabrici, eficienta si progres. produce() parcurge coloanele o singura data pentru toate liniile;
+// operator[] si iterarea intorc copii ProductionLine, deci modificarile trec doar prin metodele clasei.
+class ProductionLines {
+    std::pmr::vector<std::uint8_t> types;
+    std::pmr::vector<std::int32_t> factories;
+    // promile, in [0, EFFICIENCY_CAP]
+    std::pmr::vector<std::int32_t> efficiency;
+    // miimi de IC acumulate spre urmatoarea unitate, in [0, unitCostMilli)
+    std::pmr::vector<std::int64_t> progress;
+
+public:
+    class const_iterator {
+        const ProductionLines *lines = nullptr;
+        std::size_t index = 0;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ProductionLine;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ProductionLine;
+
+        const_iterator() = default;
+
+        const_iterator(const ProductionLines *l, std::size_t i) : lines(l), index(i) {
+        }
+
+        ProductionLine operator*() const { return (*lines)[index]; }
+
+        const_iterator &operator++() {
+            ++index;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++index;
+            return old;
+        }
+
+        bool operator==(const const_iterator &other) const { return index == other.index; }
+    };
+
+    explicit ProductionLines(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : types(resource), factories(resource), efficiency(resource), progress(resource) {
+    }
+
+    // copie ale carei coloane sunt alocate din `resource` (copierea implicita foloseste resursa implicita)
+    ProductionLines(const ProductionLines &other, std::pmr::memory_resource *resource)
+        : types(other.types, resource), factories(other.factories, resource),
+          efficiency(other.efficiency, resource), progress(other.progress, resource) {
+    }
+
+    std::size_t size() const { return types.size(); }
+
+    bool empty() const { return types.empty(); }
+
+    void add(EquipmentType type, int factoryCount, int eff = ProductionLine::EFFICIENCY_START,
+             long long carried = 0);
+
+    ProductionLine operator[](std::size_t index) const {
+        return ProductionLine(static_cast<EquipmentType>(types[index]), factories[index], efficiency[index],
+                              progress[index]);
+    }
+
+    ProductionLine back() const { return (*this)[size() - 1]; }
+
+    const_iterator begin() const { return {this, 0}; }
+
+    const_iterator end() const { return {this, size()}; }
+
+    int totalFactories() const;
+
+    void setFactories(std::size_t index, int count);
+
+    // `milOutput`: IC pe zi ale unei fabrici la eficienta maxima (SimulationParams::milOutput)
+    void produce(int days, EquipmentStockpile::Counts &produced, int milOutput = ProductionLine::MIL_OUTPUT);
+};
+
+#endif // PRODUCTION_LINES_H
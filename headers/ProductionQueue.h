@@ -1,19 +1,36 @@
 #ifndef PRODUCTION_QUEUE_H
 #define PRODUCTION_QUEUE_H
 
-#include <vector>
+#include <cstddef>
+#include <deque>
+#include <memory_resource>
+#include <utility>
 
 
 template<typename T>
 class ProductionQueue {
-    std::vector<T> queue;
+    // deque: adaugare la final si eliminare de la inceput in O(1), fara mutarea elementelor ramase
+    std::pmr::deque<T> queue;
 
 public:
+    ProductionQueue() = default;
+
+    explicit ProductionQueue(std::pmr::memory_resource *resource) : queue(resource) {
+    }
+
+    // copie alocata din `resource` (copierea implicita foloseste resursa implicita)
+    ProductionQueue(const ProductionQueue &other, std::pmr::memory_resource *resource) : queue(other.queue, resource) {
+    }
+
     // Adăugare element la final
     void add(const T &item) {
         queue.push_back(item);
     }
 
+    void add(T &&item) {
+        queue.push_back(std::move(item));
+    }
+
     // Verificare dacă e goală
     bool isEmpty() const {
         return queue.empty();
@@ -31,10 +48,15 @@ public:
     // Eliminare primul element
     void removeFirst() {
         if (!queue.empty()) {
-            queue.erase(queue.begin());
+            queue.pop_front();
         }
     }
 
+    // Eliminare element oarecare (folosit cand se finalizeaza o constructie care nu e prima)
+    auto erase(typename std::pmr::deque<T>::iterator it) {
+        return queue.erase(it);
+    }
+
     // Returnează dimensiunea
     size_t size() const { return queue.size(); }
 
@@ -0,0 +1,83 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Profiler de faze pentru tick-ul simularii si cadrele interfetei.
+//
+// PROFILE_SCOPE("nume") masoara blocul curent si adauga durata la faza "nume": numar de apeluri,
+// timp total / maxim si o histograma logaritmica din care se calculeaza percentilele. Fiecare thread
+// scrie doar in tabela proprie (fara blocari), iar report() le agrega. Fara ENABLE_PROFILER
+// (optiunea CMake cu acelasi nume) macro-ul nu genereaza niciun cod.
+namespace Profiler {
+#ifdef ENABLE_PROFILER
+    inline constexpr bool ENABLED = true;
+#else
+    inline constexpr bool ENABLED = false;
+#endif
+
+    inline constexpr std::size_t MAX_PHASES = 32;
+    // 4 sub-intervale pentru fiecare putere a lui 2 (eroare relativa de cel mult ~12% la percentile)
+    inline constexpr std::size_t HISTOGRAM_BUCKETS = 256;
+
+    struct PhaseReport {
+        std::string name;
+        std::uint64_t calls;
+        std::uint64_t totalNs;
+        std::uint64_t maxNs;
+        double meanNs;
+        std::uint64_t p50Ns;
+        std::uint64_t p90Ns;
+        std::uint64_t p99Ns;
+    };
+
+    // inregistreaza (o singura data) o faza si intoarce indexul ei; apelat din PROFILE_SCOPE
+    int registerPhase(const char *name);
+
+    void record(int phase, std::uint64_t ns);
+
+    // statisticile agregate din toate thread-urile, in ordinea inregistrarii fazelor
+    std::vector<PhaseReport> report();
+
+    void reset();
+
+    void dump(std::ostream &os);
+
+    class ScopedTimer {
+        int phase;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit ScopedTimer(int phase) : phase(phase), start(std::chrono::steady_clock::now()) {
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+        ~ScopedTimer() {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            record(phase, static_cast<std::uint64_t>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    };
+}
+
+#ifdef ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) \
+    static const int PROFILE_CONCAT(profilePhase_, __LINE__) = Profiler::registerPhase(name); \
+    Profiler::ScopedTimer PROFILE_CONCAT(profileTimer_, __LINE__)(PROFILE_CONCAT(profilePhase_, __LINE__))
+#else
+#define PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif // PROFILER_H
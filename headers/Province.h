@@ -1,6 +1,8 @@
 #ifndef PROVINCE_H
 #define PROVINCE_H
 
+#include <array>
+#include <cstddef>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -8,6 +10,10 @@
 
 #include "ResourceStockpile.h"
 #include "ResourceBase.h"
+#include "ResourceEffect.h"
+
+class BinaryWriter;
+class BinaryReader;
 
 class Province {
     std::string name;
@@ -28,7 +34,10 @@ class Province {
     int chromium{};
     int oil{};
 
-    std::vector<std::unique_ptr<AbstractResource> > resources;
+    static constexpr std::size_t MAX_RESOURCE_EFFECTS = 10;
+
+    std::array<ResourceEffect, MAX_RESOURCE_EFFECTS> effects{};
+    std::size_t effectCount = 0;
 
     void initResources();
 
@@ -48,6 +57,9 @@ public:
 
     Province(const Province &other);
 
+    // mutarea preia numele fara copiere; atribuirea prin valoare (copy-and-swap) foloseste si ea mutarea
+    Province(Province &&other) noexcept = default;
+
     Province &operator=(Province other);
 
     friend void swap(Province &a, Province &b) noexcept {
@@ -68,7 +80,8 @@ public:
         swap(a.aluminum, b.aluminum);
         swap(a.chromium, b.chromium);
         swap(a.oil, b.oil);
-        swap(a.resources, b.resources);
+        swap(a.effects, b.effects);
+        swap(a.effectCount, b.effectCount);
     }
 
     const std::string &getName() const { return name; }
@@ -99,11 +112,35 @@ public:
 
     void addAirfield(int x);
 
-    void applyResourceEffects(ResourceStockpile &stockpile) const;
+    void addArmyRF(int x);
+
+    void addNavalRF(int x);
+
+    void addAerialRF(int x);
+
+    void addNuclearRF(int x);
+
+    const ResourceEffect *effectsBegin() const { return effects.data(); }
+    const ResourceEffect *effectsEnd() const { return effects.data() + effectCount; }
+
+    // fara argument: raportul implicit SimulationParams::oilToFuel
+    std::vector<std::unique_ptr<AbstractResource> > resourceView() const;
+
+    // `oilToFuel`: fuel produs pe zi de o unitate de petrol (SimulationParams::oilToFuel al tarii)
+    std::vector<std::unique_ptr<AbstractResource> > resourceView(int oilToFuel) const;
 
     int totalConstructionSlotsFromResources() const;
 
     std::string toString() const;
+
+    std::string toString(int oilToFuel) const;
+
+    // cel mai mic numar de octeti scris de save(): lungimea numelui (u32, nume gol) si cele 15 campuri i32
+    static constexpr std::size_t MIN_SAVED_BYTES = 4 + 15 * 4;
+
+    void save(BinaryWriter &out) const;
+
+    void load(BinaryReader &in);
 };
 
 std::ostream &operator<<(std::ostream &os, const Province &p);
@@ -0,0 +1,90 @@
+#ifndef PROVINCE_STATS_H
+#define PROVINCE_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Province.h"
+
+enum class ProvinceStat {
+    Civ,
+    Mil,
+    Infra,
+    Dockyard,
+    Airfield,
+    Steel,
+    Tungsten,
+    Aluminum,
+    Chromium,
+    Oil
+};
+
+constexpr std::size_t PROVINCE_STAT_COUNT = 10;
+
+struct ProvinceTotals {
+    std::array<int, PROVINCE_STAT_COUNT> values{};
+
+    int operator[](ProvinceStat s) const { return values[static_cast<std::size_t>(s)]; }
+
+    bool operator==(const ProvinceTotals &other) const = default;
+};
+
+// Copie "structure of arrays" a statisticilor numerice ale provinciilor unei tari:
+// cate o coloana contigua de int32 pentru fiecare ProvinceStat, indexata dupa indexul provinciei.
+// Totalurile sunt mentinute incremental: update() aplica doar diferenta fata de valorile vechi,
+// deci sum()/totals() sunt O(1). recount() reface sumele cu un kernel vectorizat
+// (AVX2 / SSE2 / scalar) si este folosit pentru verificarea din modul debug.
+class ProvinceStatColumns {
+    using Column = std::pmr::vector<std::int32_t>;
+
+    std::array<Column, PROVINCE_STAT_COUNT> columns;
+    // de cate ori a fost actualizata fiecare provincie; folosit de UI pentru a redesena doar ce s-a schimbat
+    std::pmr::vector<std::uint32_t> versions;
+    ProvinceTotals cached;
+
+    template<std::size_t... I>
+    static std::array<Column, PROVINCE_STAT_COUNT> makeColumns(std::pmr::memory_resource *resource,
+                                                               std::index_sequence<I...>) {
+        return {((void) I, Column(resource))...};
+    }
+
+public:
+    explicit ProvinceStatColumns(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : columns(makeColumns(resource, std::make_index_sequence<PROVINCE_STAT_COUNT>{})), versions(resource) {
+    }
+
+    // copie ale carei coloane sunt alocate din `resource` (copierea implicita foloseste resursa implicita)
+    ProvinceStatColumns(const ProvinceStatColumns &other, std::pmr::memory_resource *resource)
+        : ProvinceStatColumns(resource) {
+        for (std::size_t s = 0; s < PROVINCE_STAT_COUNT; ++s) columns[s] = other.columns[s];
+        versions = other.versions;
+        cached = other.cached;
+    }
+
+    void assign(std::span<const Province> provinces);
+
+    void update(std::size_t index, const Province &p);
+
+    std::size_t size() const { return columns[0].size(); }
+
+    const std::int32_t *column(ProvinceStat s) const { return columns[static_cast<std::size_t>(s)].data(); }
+
+    std::uint32_t version(std::size_t index) const { return versions[index]; }
+
+    int sum(ProvinceStat s) const { return cached[s]; }
+
+    const ProvinceTotals &totals() const { return cached; }
+
+    ProvinceTotals recount() const;
+
+    bool isConsistent() const { return recount() == cached; }
+
+    static std::int32_t valueOf(const Province &p, ProvinceStat s);
+};
+
+#endif // PROVINCE_STATS_H
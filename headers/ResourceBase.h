@@ -1,6 +1,7 @@
 #ifndef RESOURCE_BASE_H
 #define RESOURCE_BASE_H
 
+#include <atomic>
 #include <string>
 #include <memory>
 #include <ostream>
@@ -11,7 +12,7 @@ class AbstractResource {
 protected:
     std::string name;
     int amount;
-    static int globalCount;
+    static std::atomic<int> globalCount;
 
     AbstractResource(std::string name, int amount);
 
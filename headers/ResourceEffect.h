@@ -0,0 +1,25 @@
+#ifndef RESOURCE_EFFECT_H
+#define RESOURCE_EFFECT_H
+
+#include <cstdint>
+
+#include "ResourceBase.h"
+
+enum class ResourceEffectKind : std::uint8_t {
+    Material,
+    DailyOutput,
+    Construction
+};
+
+// Inregistrare compacta (fara alocari, fara functii virtuale) pentru o resursa a unei provincii.
+// Tabela descrie resursele provinciei (de ex. sloturile de constructie); fuel-ul zilnic este calculat de
+// Country din totalul de petrol. Obiectele polymorfice se construiesc la cerere, pentru afisare
+// (Province::resourceView()).
+struct ResourceEffect {
+    ResourceEffectKind kind = ResourceEffectKind::Material;
+    ConstructionType building = ConstructionType::Civ; // relevant doar pentru kind == Construction
+    const char *name = "";                              // literal static, nu se copiaza
+    int amount = 0;
+};
+
+#endif // RESOURCE_EFFECT_H
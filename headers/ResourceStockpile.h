@@ -1,6 +1,8 @@
 #ifndef RESOURCE_STOCKPILE_H
 #define RESOURCE_STOCKPILE_H
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <ostream>
 
@@ -8,7 +10,10 @@ class ResourceStockpile {
     int fuel;
     int manpower;
 
-    static int clampNonNeg(int x) { return x < 0 ? 0 : x; }
+    // stocul ramane in [0, INT_MAX]; deltele mari (fastForward pe multe zile) sunt saturate, nu depasesc int
+    static int clampToRange(long long x) {
+        return static_cast<int>(std::clamp<long long>(x, 0, std::numeric_limits<int>::max()));
+    }
 
 public:
     ResourceStockpile();
@@ -19,7 +24,7 @@ public:
 
     int getManpower() const;
 
-    void add(int dFuel, int dManpower);
+    void add(long long dFuel, long long dManpower);
 
     std::string toString() const;
 };
@@ -0,0 +1,81 @@
+#ifndef SCENARIO_FILE_H
+#define SCENARIO_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Country.h"
+
+// Format binar pentru scenarii mari, citit direct din fisierul mapat in memorie (MappedFile):
+//
+//   ScenarioHeader
+//   ScenarioCountryRecord[countryCount]
+//   ScenarioProvinceRecord[provinceCount]   (provinciile fiecarei tari sunt consecutive)
+//   ScenarioLineRecord[lineCount]           (liniile de productie ale fiecarei tari sunt consecutive)
+//   tabela de string-uri (stringBytes octeti; numele sunt referite prin offset + lungime)
+//
+// Toate inregistrarile au latime fixa si contin doar intregi pe 32 de biti in ordinea nativa a octetilor.
+namespace ScenarioFile {
+    // 2: provinciile contin si santierele, aeroporturile si research facilities
+    constexpr std::uint32_t VERSION = 2;
+
+    struct ScenarioHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t countryCount;
+        std::uint32_t provinceCount;
+        std::uint32_t lineCount;
+        std::uint32_t stringBytes;
+    };
+
+    struct ScenarioCountryRecord {
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::uint32_t ideologyOffset;
+        std::uint32_t ideologyLength;
+        std::uint32_t firstProvince;
+        std::uint32_t provinceCount;
+        std::uint32_t firstLine;
+        std::uint32_t lineCount;
+        std::int32_t fuel;
+        std::int32_t manpower;
+    };
+
+    struct ScenarioProvinceRecord {
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::int32_t population;
+        std::int32_t civ;
+        std::int32_t mil;
+        std::int32_t infra;
+        std::int32_t steel;
+        std::int32_t tungsten;
+        std::int32_t aluminum;
+        std::int32_t chromium;
+        std::int32_t oil;
+        std::int32_t dockyards;
+        std::int32_t airfields;
+        std::int32_t armyRF;
+        std::int32_t navalRF;
+        std::int32_t aerialRF;
+        std::int32_t nuclearRF;
+    };
+
+    struct ScenarioLineRecord {
+        std::uint32_t type;
+        std::int32_t factories;
+    };
+
+    static_assert(sizeof(ScenarioHeader) == 32);
+    static_assert(sizeof(ScenarioCountryRecord) == 40);
+    static_assert(sizeof(ScenarioProvinceRecord) == 68);
+    static_assert(sizeof(ScenarioLineRecord) == 8);
+
+    std::vector<Country> load(const std::string &path);
+
+    void save(const std::string &path, const std::vector<Country> &countries);
+}
+
+#endif // SCENARIO_FILE_H
@@ -0,0 +1,46 @@
+#ifndef SIMULATION_PARAMS_H
+#define SIMULATION_PARAMS_H
+
+#include <array>
+#include <climits>
+#include <string>
+
+#include "Construction.h"
+#include "FocusTree.h"
+#include "ProductionLine.h"
+
+// Constantele de echilibru ale simularii. Valorile implicite sunt cele ale jocului; Engine-ul primeste
+// un set de parametri la construire si il copiaza in fiecare tara (Country::setParams), deci instante
+// diferite de Engine pot rula in paralel cu parametri diferiti (vezi ParameterSweep).
+struct SimulationParams {
+    // limita unei cladiri care nu are maxim pe provincie
+    static constexpr int NO_LIMIT = INT_MAX;
+
+    // IC produse pe zi de o fabrica militara la eficienta maxima
+    int milOutput = ProductionLine::MIL_OUTPUT;
+    // fuel produs pe zi de o unitate de petrol
+    int oilToFuel = 5;
+    // BP produse pe zi de o fabrica civila
+    double civOutputPerDay = 5.0;
+    // o constructie primeste BP de la cel mult atatea fabrici civile pe zi; surplusul trece la urmatoarea
+    int factoriesPerConstructionSlot = 15;
+
+    // costul (BP) si numarul maxim pe provincie (inclusiv cele din coada), indexate dupa BuildingType
+    std::array<double, BUILDING_TYPE_COUNT> buildingCost{100, 120, 80, 150, 200, 200, 200, 200, 200};
+    std::array<int, BUILDING_TYPE_COUNT> buildingLimit{6, 6, 5, 6, 10, NO_LIMIT, NO_LIMIT, NO_LIMIT, NO_LIMIT};
+
+    // durata (zile) fiecarui focus, in ordinea din FocusTree
+    std::array<int, FocusTree::FOCUS_COUNT> focusDays{35, 35, 25, 30};
+
+    double constructionSlotCap() const { return factoriesPerConstructionSlot * civOutputPerDay; }
+
+    // Seteaza un parametru dupa nume: milOutput, oilToFuel, civOutputPerDay, factoriesPerConstructionSlot,
+    // cost.<cladire>, limit.<cladire> (cladire = civ, mil, infra, dockyard, airfield, armyRF, navalRF,
+    // aerialRF, nuclearRF) sau focus.<index>. Arunca GameException pentru nume sau valori invalide.
+    void set(const std::string &key, const std::string &value);
+
+    // arunca GameException daca o valoare ar bloca simularea (costuri, durate sau productii <= 0, NaN sau infinite)
+    void validate() const;
+};
+
+#endif // SIMULATION_PARAMS_H
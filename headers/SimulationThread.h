@@ -0,0 +1,95 @@
+#ifndef SIMULATION_THREAD_H
+#define SIMULATION_THREAD_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <version>
+
+#include "Engine.h"
+#include "EngineCommand.h"
+
+// Starea lumii dupa o zi simulata (sau dupa aplicarea unor comenzi). Nu se mai modifica dupa publicare,
+// deci poate fi citita de interfata fara sincronizare. Tarile nemodificate fata de snapshot-ul anterior
+// sunt partajate (acelasi shared_ptr), asa ca publicarea copiaza doar tarile care s-au schimbat.
+// Doar tara urmarita (SimulationThread::watch) este adusa la ziua `day`; celelalte raman la ultima lor
+// sincronizare (countryDays), ca Engine-ul sa nu le avanseze si sa nu le copieze in fiecare zi.
+struct WorldSnapshot {
+    int day = 0;
+    std::vector<std::shared_ptr<const Country> > countries;
+    // Engine::peekCountryVersion pentru fiecare tara, la momentul publicarii
+    std::vector<std::uint64_t> countryVersions;
+    // ziua starii copiate a fiecarei tari (egala cu `day` pentru tara urmarita)
+    std::vector<int> countryDays;
+
+    const Country &country(std::size_t index) const { return *countries.at(index); }
+};
+
+// Ruleaza un Engine pe un thread propriu, cu o zi simulata la fiecare `tickPeriod` cat timp este pornit.
+// Dupa fiecare zi publica un WorldSnapshot nou prin schimbarea unui pointer (in stil RCU): cititorii
+// pastreaza snapshot-ul vechi cat timp au nevoie de el. Comenzile (post) sunt aplicate tot pe thread-ul
+// simularii, intre doua zile, deci o zi nu vede niciodata o comanda aplicata pe jumatate.
+// Dupa start(), Engine-ul nu mai trebuie folosit direct pana la stop().
+class SimulationThread {
+    Engine &engine;
+    std::chrono::steady_clock::duration tickPeriod;
+
+    // protejeaza commands, running, stopRequested, watched si republish
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<EngineCommand> commands;
+    bool running = false;
+    bool stopRequested = false;
+    // tara adusa la zi la fiecare publicare (-1 = niciuna); republish cere un snapshot nou dupa schimbare
+    int watched = -1;
+    bool republish = false;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const WorldSnapshot> > latest;
+#else
+    // fara std::atomic<std::shared_ptr> (de ex. libc++), schimbul pointerului este protejat de un mutex
+    // tinut doar pe durata copierii unui shared_ptr
+    mutable std::mutex latestMutex;
+    std::shared_ptr<const WorldSnapshot> latest;
+#endif
+
+    std::thread worker;
+
+    void loop();
+
+    void apply(const EngineCommand &command);
+
+    void publish(int watchedCountry);
+
+public:
+    SimulationThread(Engine &engine, std::chrono::steady_clock::duration tickPeriod);
+
+    SimulationThread(const SimulationThread &) = delete;
+
+    SimulationThread &operator=(const SimulationThread &) = delete;
+
+    ~SimulationThread();
+
+    void start();
+
+    // opreste si asteapta thread-ul; comenzile ramase in coada sunt aplicate inainte de oprire
+    void stop();
+
+    // pornit = zilele trec; oprit = doar comenzile sunt aplicate
+    void setRunning(bool run);
+
+    void post(const EngineCommand &command);
+
+    // tara afisata de interfata: singura adusa la ziua curenta in fiecare snapshot (-1 = niciuna)
+    void watch(int countryIndex);
+
+    // ultimul snapshot publicat; nu blocheaza thread-ul simularii
+    std::shared_ptr<const WorldSnapshot> snapshot() const;
+};
+
+#endif // SIMULATION_THREAD_H
@@ -0,0 +1,76 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+// Buffer circular fara lock-uri pentru exact un producator si un consumator (thread-uri diferite).
+// Capacitatea este rotunjita la o putere a lui 2. Indicii cresc monoton si sunt publicati cu
+// release / acquire; fiecare parte tine o copie locala a indicelui celeilalte si o reciteste doar cand
+// bufferul pare plin (producator) sau gol (consumator), ca sa nu atinga la fiecare element linia de cache
+// a celuilalt thread.
+template<typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    // dimensiunea tipica a unei linii de cache; separa indicii celor doua thread-uri
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    std::unique_ptr<T[]> slots;
+    std::size_t mask;
+
+    // urmatorul element de citit (scris doar de consumator)
+    alignas(CACHE_LINE) std::atomic<std::size_t> head{0};
+    std::size_t cachedTail = 0;
+
+    // urmatorul slot de scris (scris doar de producator)
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail{0};
+    std::size_t cachedHead = 0;
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t c = 1;
+        while (c < n) c <<= 1;
+        return c;
+    }
+
+public:
+    explicit SpscRing(std::size_t capacity)
+        : slots(std::make_unique<T[]>(roundUp(capacity))), mask(roundUp(capacity) - 1) {
+    }
+
+    SpscRing(const SpscRing &) = delete;
+
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    std::size_t capacity() const { return mask + 1; }
+
+    // doar producatorul; intoarce false (fara sa astepte) daca bufferul este plin
+    bool tryPush(const T &value) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead > mask) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead > mask) return false;
+        }
+        slots[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // doar consumatorul; muta cel mult `max` elemente in `out` si intoarce cate au fost copiate
+    std::size_t popInto(T *out, std::size_t max) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (cachedTail == h) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (cachedTail == h) return 0;
+        }
+        std::size_t n = cachedTail - h;
+        if (n > max) n = max;
+        for (std::size_t i = 0; i < n; ++i) out[i] = slots[(h + i) & mask];
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+};
+
+#endif // SPSC_RING_H
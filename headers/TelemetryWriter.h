@@ -0,0 +1,108 @@
+#ifndef TELEMETRY_WRITER_H
+#define TELEMETRY_WRITER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EquipmentCatalog.h"
+#include "SpscRing.h"
+
+// Starea unei tari la sfarsitul unei zile simulate; un rand din fisierul de telemetrie.
+struct TelemetryRecord {
+    std::int32_t day;
+    std::int32_t country;
+    std::int32_t fuel;
+    std::int32_t manpower;
+    std::int32_t civFactories;
+    std::int32_t milFactories;
+    std::int32_t usedMilFactories;
+    std::int32_t queuedConstructions;
+    // indexat dupa EquipmentType (ordinea din EQUIPMENT_CATALOG)
+    std::array<std::int64_t, EQUIPMENT_TYPE_COUNT> equipment;
+};
+
+static_assert(sizeof(TelemetryRecord) == 8 * sizeof(std::int32_t) + EQUIPMENT_TYPE_COUNT * sizeof(std::int64_t),
+              "TelemetryRecord nu trebuie sa aiba padding");
+
+// Ce face append() cand thread-ul de scriere a ramas in urma si bufferul este plin.
+enum class TelemetryOverflow {
+    // randul este pierdut si numarat (dropped()); simularea nu asteapta niciodata
+    Drop,
+    // simularea asteapta sa se elibereze un slot (rulari batch, unde seria trebuie sa fie completa)
+    Wait
+};
+
+// Scrie telemetria pe disc dintr-un thread propriu. Simularea adauga randuri intr-un SpscRing
+// (append nu face I/O si nu ia lock-uri), iar thread-ul de scriere le goleste in blocuri pe coloane.
+//
+// Formatul fisierului (ordinea nativa a octetilor; toate valorile sunt intregi cu semn):
+//   header:  char[8] "OOPTELEM", u32 versiune (= VERSION), u32 0x01020304 (marker de endianness),
+//            u32 numarul de coloane, apoi pentru fiecare coloana: u32 lungimea numelui, numele (fara '\0'),
+//            u32 dimensiunea unei valori in octeti (4 sau 8)
+//   blocuri: u32 numarul de randuri R (> 0), apoi pentru fiecare coloana, in ordinea din header,
+//            R valori consecutive
+//   final:   u32 0, u64 numarul de randuri pierdute (TelemetryOverflow::Drop)
+// Coloanele sunt: day, country, fuel, manpower, civFactories, milFactories, usedMilFactories,
+// queuedConstructions (int32) si cate o coloana "equipment.<shortName>" (int64) pentru fiecare intrare
+// din EQUIPMENT_CATALOG. Randurile apar in ordinea adaugarii: zi crescatoare, apoi indexul tarii.
+class TelemetryWriter {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 16;
+    // randuri per bloc scris pe disc
+    static constexpr std::size_t BLOCK_ROWS = 1 << 14;
+
+    explicit TelemetryWriter(const std::string &path, TelemetryOverflow overflow = TelemetryOverflow::Drop,
+                             std::size_t capacity = DEFAULT_CAPACITY);
+
+    TelemetryWriter(const TelemetryWriter &) = delete;
+
+    TelemetryWriter &operator=(const TelemetryWriter &) = delete;
+
+    // inchide fisierul fara sa arunce; erorile de scriere sunt raportate doar de close()
+    ~TelemetryWriter();
+
+    // doar de pe thread-ul simularii
+    void append(const TelemetryRecord &record);
+
+    // scrie randurile ramase si finalul fisierului; arunca TelemetryException daca scrierea a esuat
+    void close();
+
+    std::uint64_t dropped() const { return droppedRows.load(std::memory_order_relaxed); }
+
+private:
+    std::string path;
+    TelemetryOverflow overflow;
+    SpscRing<TelemetryRecord> ring;
+    std::ofstream out;
+
+    std::atomic<bool> closing{false};
+    std::atomic<bool> failed{false};
+    std::atomic<std::uint64_t> droppedRows{0};
+    // scris de thread-ul de scriere inainte de failed = true
+    std::string error;
+
+    // blocul curent, pe coloane (folosite doar de thread-ul de scriere)
+    std::vector<std::vector<std::int32_t> > intColumns;
+    std::vector<std::vector<std::int64_t> > equipmentColumns;
+
+    std::thread worker;
+
+    void writeHeader();
+
+    void loop();
+
+    void addRow(const TelemetryRecord &record);
+
+    void flushBlock();
+
+    void writeBytes(const void *data, std::size_t size);
+};
+
+#endif // TELEMETRY_WRITER_H
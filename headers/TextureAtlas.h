@@ -0,0 +1,26 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Mai multe imagini mici (iconite) asezate intr-o singura textura, ca toate quad-urile care le
+// folosesc sa poata fi desenate cu un singur apel window.draw. Imaginile sunt asezate pe randuri
+// (shelf packing), separate de un pixel liber ca filtrarea sa nu amestece iconitele vecine.
+class TextureAtlas {
+    sf::Texture texture;
+    std::vector<sf::IntRect> regions;
+
+public:
+    // incarca imaginile in ordinea data; regiunea i corespunde lui paths[i] si ramane goala
+    // daca imaginea lipseste
+    void build(const std::vector<std::string> &paths);
+
+    const sf::Texture &getTexture() const;
+
+    const sf::IntRect &getRegion(std::size_t index) const;
+};
+
+#endif // TEXTURE_ATLAS_H
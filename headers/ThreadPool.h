@@ -0,0 +1,52 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool fix de thread-uri pentru pasi paraleli de simulare.
+// parallelFor() imparte indicii [0, count) dinamic intre workeri (fiecare ia urmatorul index liber),
+// iar thread-ul apelant participa si el la lucru si asteapta finalizarea tuturor indicilor.
+class ThreadPool {
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeWorkers;
+    std::condition_variable jobDone;
+
+    const std::function<void(std::size_t)> *job = nullptr;
+    std::size_t jobSize = 0;
+    std::atomic<std::size_t> nextIndex{0};
+    std::size_t busyWorkers = 0;
+    std::uint64_t generation = 0;
+    bool stopping = false;
+
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    void workerLoop();
+
+    void runJob(const std::function<void(std::size_t)> &fn, std::size_t count);
+
+public:
+    explicit ThreadPool(unsigned extraThreads);
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool();
+
+    // numarul total de thread-uri care lucreaza la un parallelFor (workeri + apelantul)
+    unsigned concurrency() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)> &fn);
+};
+
+#endif // THREAD_POOL_H
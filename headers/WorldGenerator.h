@@ -0,0 +1,50 @@
+#ifndef WORLD_GENERATOR_H
+#define WORLD_GENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Country.h"
+
+// interval inchis [min, max] din care se aleg uniform valorile unei statistici
+struct StatRange {
+    int min;
+    int max;
+};
+
+// Descrierea unei lumi sintetice. Aceeasi descriere (inclusiv seed) produce mereu aceeasi lume.
+struct WorldSpec {
+    int countries = 10;
+    int provincesPerCountry = 100;
+    std::uint64_t seed = 1;
+
+    StatRange population{500, 3000};
+    StatRange civ{0, 4};
+    StatRange mil{0, 3};
+    StatRange infra{1, 5};
+    StatRange steel{0, 8};
+    StatRange tungsten{0, 5};
+    StatRange aluminum{0, 6};
+    StatRange chromium{0, 3};
+    StatRange oil{0, 4};
+
+    // linii de productie pe tara; fabricile militare libere sunt impartite egal intre ele
+    int productionLines = 2;
+    // constructii puse in coada pentru fiecare tara (cele care ar depasi limitele sunt sarite)
+    int queuedConstructions = 10;
+    bool activeFocus = true;
+};
+
+namespace WorldGenerator {
+    // prefixul numelor de scenariu interpretate de Engine ca lume sintetica
+    inline constexpr const char *SCENARIO_PREFIX = "synthetic:";
+
+    // "synthetic:countries=50,provinces=1000,seed=7,civ=0-4,queued=20,focus=0" (cheile lipsa raman implicite)
+    WorldSpec parseSpec(const std::string &scenario);
+
+    // tarile primesc `params` inainte de a li se pune linii si constructii in coada (costuri, limite)
+    std::vector<Country> generate(const WorldSpec &spec, const SimulationParams &params = {});
+}
+
+#endif // WORLD_GENERATOR_H
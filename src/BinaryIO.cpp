@@ -0,0 +1,19 @@
+#include "../headers/BinaryIO.h"
+#include <fstream>
+
+void BinaryWriter::saveToFile(const std::string &path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw SnapshotException("Nu se poate scrie fisierul " + path);
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!out) throw SnapshotException("Eroare la scrierea fisierului " + path);
+}
+
+std::vector<char> BinaryReader::loadFile(const std::string &path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) throw SnapshotException("Nu se poate deschide fisierul " + path);
+    std::streamsize size = in.tellg();
+    in.seekg(0);
+    std::vector<char> data(static_cast<std::size_t>(size));
+    if (!in.read(data.data(), size)) throw SnapshotException("Eroare la citirea fisierului " + path);
+    return data;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file CommandJournal.cpp
+ * @brief Inregistrarea comenzilor unei sesiuni si reluarea lor determinista.
+ */
+
+#include "../headers/CommandJournal.h"
+#include "../headers/BinaryIO.h"
+#include "../headers/Engine.h"
+#include "../headers/GameExceptions.h"
+#include <cstring>
+
+namespace {
+    constexpr char JOURNAL_MAGIC[8] = {'O', 'O', 'P', 'J', 'R', 'N', 'L', '\0'};
+    constexpr std::uint32_t JOURNAL_BYTE_ORDER = 0x01020304u;
+    constexpr std::size_t ENTRY_BYTES = 4 + 1 + 4 * 4;
+}
+
+CommandJournal::CommandJournal(std::string scenario, std::uint64_t seed, int startDay)
+    : scenario(std::move(scenario)), seed(seed), startDay(startDay), endDay(startDay) {
+}
+
+/**
+ * @brief Adauga o comanda aplicata in ziua `day`.
+ * @param day Ziua curenta a Engine-ului; zilele trebuie sa fie in ordine crescatoare.
+ * @param command Comanda aplicata.
+ */
+void CommandJournal::record(int day, const EngineCommand &command) {
+    if (day < endDay) throw JournalException("Comanda inregistrata inaintea ultimei zile din jurnal");
+    entries.push_back({day, command});
+    endDay = day;
+}
+
+void CommandJournal::setEndDay(int day) {
+    if (day < endDay) throw JournalException("Ziua finala precede ultima comanda din jurnal");
+    endDay = day;
+}
+
+void CommandJournal::save(const std::string &path) const {
+    BinaryWriter out;
+    out.writeArray(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    out.write(VERSION);
+    out.write(JOURNAL_BYTE_ORDER);
+    out.write(seed);
+    out.writeString(scenario);
+    out.write(static_cast<std::int32_t>(startDay));
+    out.write(static_cast<std::int32_t>(endDay));
+    out.write(static_cast<std::uint32_t>(entries.size()));
+    for (const auto &e: entries) {
+        out.write(e.day);
+        out.write(static_cast<std::uint8_t>(e.command.type));
+        out.write(e.command.country);
+        out.write(e.command.arg0);
+        out.write(e.command.arg1);
+        out.write(e.command.arg2);
+    }
+    out.saveToFile(path);
+}
+
+/**
+ * @brief Citeste un jurnal scris cu save().
+ * @param path Calea fisierului.
+ * @return Jurnalul citit.
+ * @throws JournalException daca fisierul lipseste, este trunchiat sau nu este un jurnal valid.
+ */
+CommandJournal CommandJournal::load(const std::string &path) {
+    // BinaryReader semnaleaza fisierele lipsa sau trunchiate cu SnapshotException
+    try {
+        return parse(path);
+    } catch (const SnapshotException &e) {
+        throw JournalException(path + ": " + e.what());
+    }
+}
+
+CommandJournal CommandJournal::parse(const std::string &path) {
+    std::vector<char> data = BinaryReader::loadFile(path);
+    BinaryReader in(data.data(), data.size());
+
+    char magic[sizeof(JOURNAL_MAGIC)];
+    in.readArray(magic, sizeof(magic));
+    if (std::memcmp(magic, JOURNAL_MAGIC, sizeof(magic)) != 0)
+        throw JournalException(path + " nu este un jurnal de comenzi");
+    auto version = in.read<std::uint32_t>();
+    if (version != VERSION)
+        throw JournalException("Versiune de jurnal nesuportata: " + std::to_string(version));
+    if (in.read<std::uint32_t>() != JOURNAL_BYTE_ORDER)
+        throw JournalException("Jurnal scris pe o platforma cu alta ordine a octetilor");
+
+    auto loadedSeed = in.read<std::uint64_t>();
+    std::string loadedScenario = in.readString();
+    auto start = in.read<std::int32_t>();
+    auto end = in.read<std::int32_t>();
+    auto count = in.read<std::uint32_t>();
+    if (start < 0 || end < start || count > in.remaining() / ENTRY_BYTES)
+        throw JournalException("Header de jurnal invalid");
+
+    CommandJournal journal(std::move(loadedScenario), loadedSeed, start);
+    journal.entries.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        auto day = in.read<std::int32_t>();
+        auto type = in.read<std::uint8_t>();
+        if (type > static_cast<std::uint8_t>(CommandType::ModifyLineFactories))
+            throw JournalException("Tip de comanda invalid in jurnal: " + std::to_string(type));
+        EngineCommand command{static_cast<CommandType>(type), in.read<std::int32_t>()};
+        command.arg0 = in.read<std::int32_t>();
+        command.arg1 = in.read<std::int32_t>();
+        command.arg2 = in.read<std::int32_t>();
+        journal.record(day, command);
+    }
+    if (in.remaining() != 0) throw JournalException("Date suplimentare la sfarsitul jurnalului");
+    journal.setEndDay(end);
+    return journal;
+}
+
+/**
+ * @brief Reface sesiunea inregistrata: fiecare comanda este aplicata dupa simularea zilei ei,
+ *        exact ca pe thread-ul simularii, iar la final Engine-ul este adus la getEndDay().
+ * @param engine Engine construit din scenariul si seed-ul jurnalului.
+ * @return Numarul de comenzi refuzate (GameException) si ignorate; jurnalul contine doar comenzi acceptate,
+ *         deci o valoare nenula inseamna ca reluarea s-a abatut de la sesiunea originala.
+ * @throws JournalException daca Engine-ul nu este la ziua de start a jurnalului.
+ */
+std::size_t CommandJournal::replay(Engine &engine) const {
+    if (engine.getDay() != startDay)
+        throw JournalException("Jurnalul incepe in ziua " + std::to_string(startDay) + ", Engine-ul este in ziua " +
+                               std::to_string(engine.getDay()));
+    std::size_t rejected = 0;
+    for (const auto &e: entries) {
+        engine.advance(e.day - engine.getDay());
+        try {
+            engine.execute(e.command);
+        } catch (const GameException &) {
+            ++rejected;
+        }
+    }
+    engine.advance(endDay - engine.getDay());
+    return rejected;
+}
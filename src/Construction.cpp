@@ -9,6 +9,13 @@ Construction::Construction(BuildingType type, int provinceIndex, double totalCos
       totalCost(totalCost) {
 }
 
+Construction::Construction(BuildingType type, int provinceIndex, double totalCost, double remainingBP)
+    : type(type),
+      provinceIndex(provinceIndex),
+      remainingBP(GameUtils::ensureRange<double>(remainingBP, 0.0, totalCost)),
+      totalCost(totalCost) {
+}
+
 bool Construction::progress(double dailyBP) {
     remainingBP -= dailyBP;
 
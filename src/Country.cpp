@@ -3,17 +3,26 @@
  * @brief Implementarea clasei Country: gestiune provincii, productie, constructii si focus tree.
  *
  * Fisierul contine implementarea metodelor pentru:
- *  - agregarea statisticilor din provincii (fabrici, resurse)
+ *  - agregarea statisticilor din provincii (fabrici, resurse): totaluri mentinute incremental in
+ *    provinceStats la fiecare modificare a unei provincii, deci interogarile sunt O(1)
  *  - managementul liniilor de productie militara
  *  - coada de constructii si progres zilnic
  *  - tick zilnic (simulateDay) incluzand focus tree effects
+ *  - avans analitic peste zilele "stabile" (daysUntilNextEvent / fastForward)
+ *
+ * Containerele tarii (provincii, coloane SoA, linii, coada, contoare) aloca din arena proprie
+ * (CountryArena), daca proiectul nu este compilat cu NO_COUNTRY_ARENA.
  */
 
 #include "../headers/Country.h"
 #include "../headers/GameExceptions.h"
+#include "../headers/BinaryIO.h"
+#include "../headers/Profiler.h"
 #include <sstream>
+#include <algorithm>
+#include <cassert>
 #include <cmath>
-#include <cstdlib>
+#include <limits>
 #include <iostream>
 
 /**
@@ -24,17 +33,74 @@
  * @param r Stocul initial de resurse.
  */
 Country::Country(std::string n, std::string id, std::vector<Province> p, ResourceStockpile r)
-    : name(std::move(n)), ideology(std::move(id)), provinces(std::move(p)), resources(r) {
+    : arena(makeArena()), name(std::move(n)), ideology(std::move(id)),
+      provinces(std::make_move_iterator(p.begin()), std::make_move_iterator(p.end()), memory()),
+      provinceStats(memory()), resources(r), milLines(memory()), constructions(memory()),
+      queuedCounts(provinces.size(), std::array<int, BUILDING_TYPE_COUNT>{}, memory()) {
+    provinceStats.assign(provinces);
 }
 
 /**
- * @brief Copy-constructor.
+ * @brief Copy-constructor. Copia primeste o arena noua, in care sunt copiate toate containerele.
  * @param other Obiectul sursa.
  */
 Country::Country(const Country &other)
-    : name(other.name), ideology(other.ideology), provinces(other.provinces),
-      resources(other.resources), equipment(other.equipment),
-      milLines(other.milLines), constructions(other.constructions), focusTree(other.focusTree) {
+    : arena(makeArena()), name(other.name), ideology(other.ideology), provinces(other.provinces, memory()),
+      provinceStats(other.provinceStats, memory()), resources(other.resources), equipment(other.equipment),
+      milLines(other.milLines, memory()), usedMilFactories(other.usedMilFactories),
+      constructions(other.constructions, memory()), queuedCounts(other.queuedCounts, memory()),
+      constructionSlotCap(other.constructionSlotCap), focusTree(other.focusTree), rng(other.rng), elapsedDays(other.elapsedDays),
+      params(other.params) {
+}
+
+/**
+ * @brief Move-constructor. Containerele raman in arena sursei, care este preluata (partajat) de obiectul nou.
+ * @param other Obiectul sursa.
+ */
+Country::Country(Country &&other) noexcept
+    : arena(other.arena), name(std::move(other.name)), ideology(std::move(other.ideology)),
+      provinces(std::move(other.provinces)), provinceStats(std::move(other.provinceStats)),
+      resources(other.resources), equipment(other.equipment), milLines(std::move(other.milLines)),
+      usedMilFactories(other.usedMilFactories), constructions(std::move(other.constructions)),
+      queuedCounts(std::move(other.queuedCounts)), constructionSlotCap(other.constructionSlotCap),
+      focusTree(std::move(other.focusTree)), rng(other.rng), elapsedDays(other.elapsedDays), params(other.params) {
+}
+
+/**
+ * @brief Move assignment.
+ *
+ * Alocatorii polimorfici nu se propaga la atribuire, deci o atribuire membru cu membru ar copia elementele
+ * in arena veche. In schimb obiectul curent este distrus si reconstruit prin mutare, preluand arena sursei.
+ *
+ * @param other Obiectul sursa.
+ * @return Referinta la obiectul curent.
+ */
+Country &Country::operator=(Country &&other) noexcept {
+    if (this != &other) {
+        std::destroy_at(this);
+        std::construct_at(this, std::move(other));
+    }
+    return *this;
+}
+
+/**
+ * @brief Creeaza arena unei tari noi (nullptr cand proiectul este compilat cu NO_COUNTRY_ARENA).
+ * @return Arena noua.
+ */
+std::shared_ptr<CountryArena> Country::makeArena() {
+#ifdef NO_COUNTRY_ARENA
+    return nullptr;
+#else
+    return std::make_shared<CountryArena>();
+#endif
+}
+
+/**
+ * @brief Resursa de memorie folosita de containerele tarii.
+ * @return Pool-ul arenei sau resursa implicita daca arena este dezactivata.
+ */
+std::pmr::memory_resource *Country::memory() const {
+    return arena ? &arena->pool : std::pmr::get_default_resource();
 }
 
 /**
@@ -47,95 +113,124 @@ Country &Country::operator=(const Country &other) {
         name = other.name;
         ideology = other.ideology;
         provinces = other.provinces;
+        provinceStats = other.provinceStats;
         resources = other.resources;
         equipment = other.equipment;
         milLines = other.milLines;
+        usedMilFactories = other.usedMilFactories;
         constructions = other.constructions;
+        queuedCounts = other.queuedCounts;
+        constructionSlotCap = other.constructionSlotCap;
         focusTree = other.focusTree;
+        rng = other.rng;
+        elapsedDays = other.elapsedDays;
+        params = other.params;
     }
     return *this;
 }
 
 /**
- * @brief Calculeaza totalul de fabrici civile din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de fabrici civile din toate provinciile.
  * @return Numarul total de fabrici civile.
  */
 int Country::totalCiv() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getCiv();
-    return s;
+    return provinceStats.sum(ProvinceStat::Civ);
 }
 
 /**
- * @brief Calculeaza totalul de fabrici militare din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de fabrici militare din toate provinciile.
  * @return Numarul total de fabrici militare.
  */
 int Country::totalMil() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getMil();
-    return s;
+    return provinceStats.sum(ProvinceStat::Mil);
 }
 
 /**
- * @brief Calculeaza totalul de petrol (oil) din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de petrol (oil) din toate provinciile.
  * @return Totalul de oil.
  */
 int Country::totalOil() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getOil();
-    return s;
+    return provinceStats.sum(ProvinceStat::Oil);
 }
 
 /**
- * @brief Calculeaza totalul de otel (steel) din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de otel (steel) din toate provinciile.
  * @return Totalul de steel.
  */
 int Country::totalSteel() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getSteel();
-    return s;
+    return provinceStats.sum(ProvinceStat::Steel);
 }
 
 /**
- * @brief Calculeaza totalul de tungsten din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de tungsten din toate provinciile.
  * @return Totalul de tungsten.
  */
 int Country::totalTungsten() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getTungsten();
-    return s;
+    return provinceStats.sum(ProvinceStat::Tungsten);
 }
 
 /**
- * @brief Calculeaza totalul de aluminiu (aluminum) din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de aluminiu (aluminum) din toate provinciile.
  * @return Totalul de aluminum.
  */
 int Country::totalAluminum() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getAluminum();
-    return s;
+    return provinceStats.sum(ProvinceStat::Aluminum);
 }
 
 /**
- * @brief Calculeaza totalul de crom (chromium) din toate provinciile.
+ * @brief Returneaza totalul (mentinut incremental) de crom (chromium) din toate provinciile.
  * @return Totalul de chromium.
  */
 int Country::totalChromium() const {
-    int s = 0;
-    for (const auto &p: provinces) s += p.getChromium();
-    return s;
+    return provinceStats.sum(ProvinceStat::Chromium);
+}
+
+/**
+ * @brief Returneaza toate totalurile provinciilor (fabrici, cladiri, resurse).
+ * @return Structura cu suma fiecarei statistici ProvinceStat.
+ */
+const ProvinceTotals &Country::provinceTotals() const {
+    return provinceStats.totals();
+}
+
+/**
+ * @brief Numarul de modificari ale unei provincii de la crearea tarii.
+ * @param provinceIndex Indexul provinciei.
+ * @return Versiunea provinciei; doua citiri egale inseamna ca provincia nu s-a schimbat intre ele.
+ */
+std::uint32_t Country::getProvinceVersion(int provinceIndex) const {
+    return provinceStats.version(static_cast<std::size_t>(provinceIndex));
+}
+
+/**
+ * @brief Sincronizeaza coloanele SoA si totalurile dupa modificarea unei provincii.
+ * @param provinceIndex Indexul provinciei modificate.
+ */
+void Country::refreshProvinceStats(int provinceIndex) {
+    provinceStats.update(static_cast<std::size_t>(provinceIndex), provinces[provinceIndex]);
+    checkAggregates();
+}
+
+/**
+ * @brief Verifica (doar in build-urile debug) ca agregatele incrementale coincid cu o renumarare completa.
+ */
+void Country::checkAggregates() const {
+#ifndef NDEBUG
+    assert(provinceStats.isConsistent());
+    assert(milLines.totalFactories() == usedMilFactories);
+
+    std::pmr::vector<std::array<int, BUILDING_TYPE_COUNT> > queued(provinces.size());
+    for (const auto &c: constructions) queued[c.getProvinceIndex()][static_cast<std::size_t>(c.getType())]++;
+    assert(queued == queuedCounts);
+#endif
 }
 
 /**
- * @brief Calculeaza cate fabrici militare sunt deja alocate pe liniile de productie.
+ * @brief Returneaza cate fabrici militare sunt deja alocate pe liniile de productie.
  * @return Numarul de fabrici militare utilizate.
  */
 int Country::getUsedMilFactories() const {
-    int used = 0;
-    for (const auto &line: milLines) {
-        used += line.getFactories();
-    }
-    return used;
+    return usedMilFactories;
 }
 
 /**
@@ -154,6 +249,7 @@ int Country::getFreeMilFactories() const {
  * @brief Adauga o noua linie de productie pentru un tip de echipament.
  *
  * Aloca implicit 1 fabrica daca exista fabrici militare libere; altfel aloca 0.
+ * Linia porneste de la ProductionLine::EFFICIENCY_START.
  *
  * @param t Tipul de echipament produs pe linie.
  */
@@ -162,7 +258,9 @@ void Country::addProductionLine(EquipmentType t) {
     if (getFreeMilFactories() <= 0) {
         factoriesToAssign = 0;
     }
-    milLines.push_back(ProductionLine(t, factoriesToAssign, 0.0));
+    milLines.add(t, factoriesToAssign);
+    usedMilFactories += factoriesToAssign;
+    checkAggregates();
 }
 
 /**
@@ -171,24 +269,27 @@ void Country::addProductionLine(EquipmentType t) {
  * Daca amount > 0: incearca sa adauge fabrici (doar daca sunt suficiente libere).
  * Daca amount < 0: scoate fabrici, dar fara a scadea sub 0.
  * Daca index este invalid: nu face nimic.
+ * Eficienta liniei scade conform ProductionLines::setFactories.
  *
  * @param index Indexul liniei in vectorul de linii de productie.
  * @param amount Diferenta de fabrici (pozitiv / negativ).
  */
 void Country::modifyLineFactories(int index, int amount) {
     if (index < 0 || index >= static_cast<int>(milLines.size())) return;
-    ProductionLine &line = milLines[index];
-    int current = line.getFactories();
+    int current = milLines[index].getFactories();
 
     if (amount > 0) {
         if (getFreeMilFactories() >= amount) {
-            line.setFactories(current + amount);
+            milLines.setFactories(index, current + amount);
+            usedMilFactories += amount;
         }
-    } else {
+    } else if (amount < 0) {
         if (current + amount >= 0) {
-            line.setFactories(current + amount);
+            milLines.setFactories(index, current + amount);
+            usedMilFactories += amount;
         }
     }
+    checkAggregates();
 }
 
 /**
@@ -197,21 +298,15 @@ void Country::modifyLineFactories(int index, int amount) {
  * @return Numarul de unitati din tipul respectiv.
  */
 long long Country::getEquipmentCount(EquipmentType t) const {
-    switch (t) {
-        case EquipmentType::Gun: return equipment.getGuns();
-        case EquipmentType::Artillery: return equipment.getArtillery();
-        case EquipmentType::AntiAir: return equipment.getAntiAir();
-        case EquipmentType::CAS: return equipment.getCAS();
-    }
-    return 0;
+    return equipment.get(t);
 }
 
 /**
  * @brief Porneste un focus din focus tree.
  * @param index Indexul focus-ului (conform structurii focusTree).
- * @return true daca focus-ul a pornit cu succes, false altfel.
+ * @return Started daca focus-ul a pornit, altfel motivul refuzului.
  */
-bool Country::startFocus(int index) {
+FocusStartResult Country::startFocus(int index) {
     return focusTree.startFocus(index);
 }
 
@@ -221,9 +316,9 @@ bool Country::startFocus(int index) {
  * Valideaza:
  *  - count > 0
  *  - index provincie valid
- *  - limite maxime (inclusiv ce este deja in coada pentru acea provincie)
+ *  - limite maxime (inclusiv ce este deja in coada pentru acea provincie, citit in O(1) din queuedCounts)
  *
- * Costul per constructie depinde de tipul cladirii.
+ * Limitele si costul per constructie depind de tipul cladirii (SimulationParams::buildingLimit / buildingCost).
  *
  * @param type Tipul cladirii care se construieste.
  * @param provinceIndex Indexul provinciei tinta.
@@ -237,60 +332,145 @@ void Country::addConstruction(BuildingType type, int provinceIndex, int count) {
     if (provinceIndex < 0 || static_cast<std::size_t>(provinceIndex) >= provinces.size())
         throw InvalidProvinceIndexException("Index provincie invalid", provinceIndex);
 
-    const Province &prov = provinces[provinceIndex];
-
-    int queuedCiv = 0;
-    int queuedMil = 0;
-    int queuedInfra = 0;
-    int queuedAir = 0;
-    int queuedDock = 0;
-    for (const auto &c: constructions) {
-        if (c.getProvinceIndex() == provinceIndex) {
-            switch (c.getType()) {
-                case BuildingType::Civ: queuedCiv++;
-                    break;
-                case BuildingType::Mil: queuedMil++;
-                    break;
-                case BuildingType::Infra: queuedInfra++;
-                    break;
-                case BuildingType::Airfield: queuedAir++;
-                    break;
-                case BuildingType::Dockyard: queuedDock++;
-                    break;
-                default: break;
-            }
-        }
+    const auto t = static_cast<std::size_t>(type);
+    const int limit = params.buildingLimit[t];
+    if (static_cast<long long>(builtCount(provinceIndex, type)) + queuedCounts[provinceIndex][t] + count > limit) {
+        static constexpr std::array<const char *, BUILDING_TYPE_COUNT> LABELS{
+            "Fabrici Civile", "Fabrici Militare", "Infrastructura", "Santiere Navale", "Aeroporturi",
+            "Army RF", "Naval RF", "Aerial RF", "Nuclear RF"
+        };
+        throw GameException("Limita atinsa: Maxim " + std::to_string(limit) + " " + LABELS[t] + "!");
     }
 
-    if (type == BuildingType::Infra) {
-        if (prov.getInfra() + queuedInfra + count > 5) throw GameException(
-            "Limita atinsa: Infrastructura maxima este 5!");
-    } else if (type == BuildingType::Airfield) {
-        if (prov.getAirfields() + queuedAir + count > 10) throw GameException("Limita atinsa: Aeroporturi maxime 10!");
-    } else if (type == BuildingType::Civ) {
-        if (prov.getCiv() + queuedCiv + count > 6) throw GameException("Limita atinsa: Maxim 6 Fabrici Civile!");
-    } else if (type == BuildingType::Mil) {
-        if (prov.getMil() + queuedMil + count > 6) throw GameException("Limita atinsa: Maxim 6 Fabrici Militare!");
-    } else if (type == BuildingType::Dockyard) {
-        if (prov.getDockyards() + queuedDock + count > 6) throw GameException("Limita atinsa: Maxim 6 Santier Navale!");
+    const double cost = params.buildingCost[t];
+
+    for (int i = 0; i < count; ++i) {
+        constructions.add(Construction(type, provinceIndex, cost));
     }
+    queuedCounts[provinceIndex][static_cast<std::size_t>(type)] += count;
+    checkAggregates();
+}
 
-    double cost = 200;
+/**
+ * @brief Returneaza cate cladiri de un anumit tip exista deja intr-o provincie (fara cele din coada).
+ * @param provinceIndex Indexul provinciei (valid).
+ * @param type Tipul cladirii.
+ * @return Numarul de cladiri construite.
+ */
+int Country::builtCount(int provinceIndex, BuildingType type) const {
+    const Province &prov = provinces[provinceIndex];
     switch (type) {
-        case BuildingType::Civ: cost = 100;
+        case BuildingType::Civ: return prov.getCiv();
+        case BuildingType::Mil: return prov.getMil();
+        case BuildingType::Infra: return prov.getInfra();
+        case BuildingType::Dockyard: return prov.getDockyards();
+        case BuildingType::Airfield: return prov.getAirfields();
+        case BuildingType::ArmyRF: return prov.getArmyRF();
+        case BuildingType::NavalRF: return prov.getNavalRF();
+        case BuildingType::AerialRF: return prov.getAerialRF();
+        case BuildingType::NuclearRF: return prov.getNuclearRF();
+    }
+    return 0;
+}
+
+/**
+ * @brief Returneaza cate constructii de un anumit tip sunt in coada pentru o provincie.
+ * @param provinceIndex Indexul provinciei.
+ * @param type Tipul cladirii.
+ * @return Numarul de constructii in asteptare (0 pentru index invalid).
+ */
+int Country::getQueuedCount(int provinceIndex, BuildingType type) const {
+    if (provinceIndex < 0 || static_cast<std::size_t>(provinceIndex) >= queuedCounts.size()) return 0;
+    return queuedCounts[provinceIndex][static_cast<std::size_t>(type)];
+}
+
+/**
+ * @brief Initializeaza fluxul aleator propriu tarii.
+ *
+ * Numerele aleatoare sunt functii pure de (seed, zi, indexul tarii) (CounterRng), deci nu depind
+ * de ordinea in care sunt simulate tarile si nici de cate ori a fost apelat generatorul inainte.
+ *
+ * @param seed Seed-ul global al Engine-ului.
+ * @param countryIndex Indexul tarii in Engine.
+ */
+void Country::seedRandom(std::uint64_t seed, std::uint32_t countryIndex) {
+    rng = CounterRng(seed, countryIndex);
+}
+
+/**
+ * @brief Seteaza plafonul de BP pe zi pe care il poate primi o singura constructie.
+ * @param bpPerDay Plafonul (valori <= 0 sunt ignorate).
+ */
+void Country::setConstructionSlotCap(double bpPerDay) {
+    if (bpPerDay > 0) constructionSlotCap = bpPerDay;
+}
+
+/**
+ * @brief Inlocuieste constantele de echilibru ale tarii.
+ *
+ * Plafonul de slot este recalculat din parametri (setConstructionSlotCap il poate suprascrie apoi),
+ * iar duratele focus-urilor sunt aplicate focus tree-ului. Constructiile deja din coada isi pastreaza costul.
+ *
+ * @param p Parametrii noi (validati de apelant, vezi SimulationParams::validate).
+ */
+void Country::setParams(const SimulationParams &p) {
+    params = p;
+    constructionSlotCap = params.constructionSlotCap();
+    focusTree.setDurations(params.focusDays);
+}
+
+/**
+ * @brief Aplica efectul unei constructii finalizate asupra provinciei tinta.
+ * @param c Constructia finalizata.
+ */
+void Country::completeConstruction(const Construction &c) {
+    int idx = c.getProvinceIndex();
+    if (idx < 0 || idx >= static_cast<int>(provinces.size())) return;
+    switch (c.getType()) {
+        case BuildingType::Civ: provinces[idx].addCiv(1);
+            break;
+        case BuildingType::Mil: provinces[idx].addMil(1);
+            break;
+        case BuildingType::Infra: provinces[idx].addInfra(1);
+            break;
+        case BuildingType::Dockyard: provinces[idx].addDockyard(1);
             break;
-        case BuildingType::Mil: cost = 120;
+        case BuildingType::Airfield: provinces[idx].addAirfield(1);
             break;
-        case BuildingType::Infra: cost = 80;
+        case BuildingType::ArmyRF: provinces[idx].addArmyRF(1);
             break;
-        case BuildingType::Dockyard: cost = 150;
+        case BuildingType::NavalRF: provinces[idx].addNavalRF(1);
             break;
-        default: cost = 200;
+        case BuildingType::AerialRF: provinces[idx].addAerialRF(1);
+            break;
+        case BuildingType::NuclearRF: provinces[idx].addNuclearRF(1);
             break;
     }
+    refreshProvinceStats(idx);
+    queuedCounts[idx][static_cast<std::size_t>(c.getType())]--;
+}
 
-    for (int i = 0; i < count; ++i) {
-        constructions.add(Construction(type, provinceIndex, cost));
+/**
+ * @brief Imparte BP-ul zilnic pe constructiile din coada.
+ *
+ * Constructiile sunt servite in ordinea din coada; fiecare primeste cel mult constructionSlotCap BP.
+ * BP-ul ramas dupa finalizarea unei constructii trece la urmatoarea, deci intr-o zi se pot
+ * finaliza mai multe cladiri. BP-ul ramas cand coada se goleste se pierde.
+ *
+ * @param dailyBP BP-ul disponibil in ziua curenta.
+ */
+void Country::progressConstructions(double dailyBP) {
+    double budget = dailyBP;
+    auto it = constructions.begin();
+    while (budget > 0 && it != constructions.end()) {
+        double used = std::min({budget, constructionSlotCap, it->getRemainingBP()});
+        budget -= used;
+        if (it->progress(used)) {
+            completeConstruction(*it);
+            it = constructions.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
@@ -298,57 +478,36 @@ void Country::addConstruction(BuildingType type, int provinceIndex, int count) {
  * @brief Simuleaza o zi de joc pentru tara curenta.
  *
  * Include:
- *  - aplicarea efectelor de resurse la nivel de provincie
- *  - productia zilnica a liniilor militare (adauga echipament)
- *  - progresul pe prima constructie din coada (daca exista)
+ *  - fuel-ul produs de petrolul provinciilor (dailyFuelOutput)
+ *  - productia zilnica a liniilor militare (adauga echipament, creste eficienta liniilor)
+ *  - progresul constructiilor din coada, pe mai multe sloturi in paralel (vezi progressConstructions)
  *  - tick pentru focus tree si aplicarea unui efect random pe o provincie (daca exista efect)
  */
 void Country::simulateDay() {
-    for (const auto &p: provinces) p.applyResourceEffects(resources);
+    PROFILE_SCOPE("country.simulateDay");
+    ++elapsedDays;
 
-    for (const auto &l: milLines) {
-        long long units = l.calculateDailyOutput();
-        switch (l.getType()) {
-            case EquipmentType::Gun: equipment.addGuns(units);
-                break;
-            case EquipmentType::Artillery: equipment.addArtillery(units);
-                break;
-            case EquipmentType::AntiAir: equipment.addAntiAir(units);
-                break;
-            case EquipmentType::CAS: equipment.addCAS(units);
-                break;
-        }
+    {
+        PROFILE_SCOPE("country.resources");
+        resources.add(dailyFuelOutput(), 0);
     }
 
-    double dailyBP = totalCiv() * CIV_OUTPUT_PER_DAY;
-    if (!constructions.isEmpty()) {
-        Construction &c = constructions.front();
-        if (c.progress(dailyBP)) {
-            int idx = c.getProvinceIndex();
-            if (idx >= 0 && idx < static_cast<int>(provinces.size())) {
-                try {
-                    switch (c.getType()) {
-                        case BuildingType::Civ: provinces[idx].addCiv(1);
-                            break;
-                        case BuildingType::Mil: provinces[idx].addMil(1);
-                            break;
-                        case BuildingType::Infra: provinces[idx].addInfra(1);
-                            break;
-                        case BuildingType::Dockyard: provinces[idx].addDockyard(1);
-                            break;
-                        default: provinces[idx].addAirfield(1);
-                            break;
-                    }
-                } catch (...) {
-                }
-            }
-            constructions.removeFirst();
-        }
+    {
+        PROFILE_SCOPE("country.production");
+        EquipmentStockpile::Counts produced{};
+        milLines.produce(1, produced, params.milOutput);
+        equipment.addAll(produced);
     }
 
+    {
+        PROFILE_SCOPE("country.construction");
+        progressConstructions(totalCiv() * params.civOutputPerDay);
+    }
+
+    PROFILE_SCOPE("country.focus");
     int effRaw = focusTree.tickRaw();
     if (effRaw != -1 && !provinces.empty()) {
-        int i = std::rand() % static_cast<int>(provinces.size());
+        int i = static_cast<int>(rng.below(static_cast<std::uint32_t>(provinces.size()), elapsedDays));
         switch (static_cast<FocusEffectType>(effRaw)) {
             case FocusEffectType::AddCiv: provinces[i].addCiv(1);
                 break;
@@ -359,7 +518,93 @@ void Country::simulateDay() {
             case FocusEffectType::AddDockyard: provinces[i].addDockyard(1);
                 break;
         }
+        refreshProvinceStats(i);
+    }
+}
+
+/**
+ * @brief Calculeaza combustibilul produs intr-o zi de toate provinciile.
+ *
+ * Fiecare unitate de petrol produce params.oilToFuel fuel pe zi, deci totalul se obtine in O(1)
+ * din suma de petrol mentinuta in provinceStats.
+ *
+ * @return Fuel-ul zilnic total (long long: produsul poate depasi int).
+ */
+long long Country::dailyFuelOutput() const {
+    return static_cast<long long>(totalOil()) * params.oilToFuel;
+}
+
+/**
+ * @brief Calculeaza in cate zile are loc urmatorul eveniment discret al tarii.
+ *
+ * Un eveniment este finalizarea unei constructii sau a focus-ului activ. Pana atunci fiecare zi este
+ * "stabila": fuel-ul creste liniar, echipamentul urmeaza cresterea de eficienta a liniilor (calculata
+ * exact in forma inchisa de ProductionLines::produce), iar fiecare constructie activa primeste acelasi BP
+ * (distributia pe sloturi se schimba doar cand se finalizeaza ceva).
+ *
+ * @return Evenimentul cel mai apropiat: days = k >= 1 daca are loc in a k-a zi simulata de acum,
+ *         sau days = NO_EVENT si kind = None daca nu exista niciunul.
+ */
+CountryEvent Country::nextEvent() const {
+    long long next = NO_EVENT;
+    CountryEventKind kind = CountryEventKind::None;
+
+    int focusLeft = focusTree.daysRemaining();
+    if (focusLeft != -1) {
+        next = focusLeft;
+        kind = CountryEventKind::Focus;
+    }
+
+    double budget = totalCiv() * params.civOutputPerDay;
+    for (auto it = constructions.begin(); budget > 0 && it != constructions.end(); ++it) {
+        double share = std::min(budget, constructionSlotCap);
+        double remaining = it->getRemainingBP();
+        if (remaining <= share) return CountryEvent{1, CountryEventKind::Construction};
+        budget -= share;
+
+        // cea mai mica zi k pentru care remaining - k * share <= 0
+        auto k = static_cast<long long>(std::ceil(remaining / share));
+        while (k > 1 && remaining - static_cast<double>(k - 1) * share <= 0) --k;
+        while (remaining - static_cast<double>(k) * share > 0) ++k;
+        if (k < next) {
+            next = k;
+            kind = CountryEventKind::Construction;
+        }
     }
+    return CountryEvent{static_cast<int>(std::min<long long>(next, NO_EVENT)), kind};
+}
+
+/**
+ * @brief Avanseaza tara cu mai multe zile stabile dintr-o data.
+ *
+ * Aplica deltele acumulate (fuel, echipament, BP pe constructiile active, progres focus) intr-un singur pas.
+ * Rezultatul este identic cu `days` apeluri simulateDay() atata timp cat days < nextEvent().days;
+ * pentru BP, egalitatea este exacta cand costurile si plafonul de slot sunt valori intregi (cazul curent).
+ *
+ * @param days Numarul de zile stabile de aplicat.
+ */
+void Country::fastForward(int days) {
+    if (days <= 0) return;
+    PROFILE_SCOPE("country.fastForward");
+    elapsedDays += days;
+
+    // fuel-ul zilnic este >= 0, deci saturarea totalului da acelasi stoc ca `days` adaugari saturate
+    const long long fuelPerDay = dailyFuelOutput();
+    const long long maxFuel = std::numeric_limits<int>::max();
+    resources.add(fuelPerDay > maxFuel / days ? maxFuel : fuelPerDay * days, 0);
+
+    EquipmentStockpile::Counts produced{};
+    milLines.produce(days, produced, params.milOutput);
+    equipment.addAll(produced);
+
+    double budget = totalCiv() * params.civOutputPerDay;
+    for (auto it = constructions.begin(); budget > 0 && it != constructions.end(); ++it) {
+        double share = std::min(budget, constructionSlotCap);
+        budget -= share;
+        it->progress(share * days);
+    }
+
+    focusTree.advance(days);
 }
 
 /**
@@ -372,6 +617,109 @@ std::string Country::toString() const {
     return ss.str();
 }
 
+/**
+ * @brief Scrie starea completa a tarii in formatul binar al snapshot-urilor.
+ *
+ * Se salveaza doar starea primara (provincii, stocuri, linii, coada, focus, ziua simulata);
+ * agregatele (provinceStats, usedMilFactories, queuedCounts) sunt recalculate la incarcare, iar
+ * fluxul aleator este refacut de Engine din seed si indexul tarii.
+ *
+ * @param out Buffer-ul de iesire.
+ */
+void Country::save(BinaryWriter &out) const {
+    out.writeString(name);
+    out.writeString(ideology);
+
+    out.write(static_cast<std::uint32_t>(provinces.size()));
+    for (const auto &p: provinces) p.save(out);
+
+    out.write(static_cast<std::int32_t>(resources.getFuel()));
+    out.write(static_cast<std::int32_t>(resources.getManpower()));
+    equipment.save(out);
+
+    out.write(static_cast<std::uint32_t>(milLines.size()));
+    for (const auto &line: milLines) {
+        out.write(static_cast<std::int32_t>(line.getType()));
+        out.write(static_cast<std::int32_t>(line.getFactories()));
+        out.write(static_cast<std::int32_t>(line.getEfficiency()));
+        out.write(static_cast<std::int64_t>(line.getProgress()));
+    }
+
+    out.write(static_cast<std::uint32_t>(constructions.size()));
+    for (const auto &c: constructions) {
+        out.write(static_cast<std::int32_t>(c.getType()));
+        out.write(static_cast<std::int32_t>(c.getProvinceIndex()));
+        out.write(c.getTotalCost());
+        out.write(c.getRemainingBP());
+    }
+    out.write(constructionSlotCap);
+
+    focusTree.save(out);
+
+    out.write(static_cast<std::int32_t>(elapsedDays));
+}
+
+/**
+ * @brief Reconstruieste o tara scrisa cu save().
+ * @param in Cititorul binar.
+ * @return Tara restaurata, cu agregatele recalculate.
+ * @throws SnapshotException daca datele sunt trunchiate sau inconsistente.
+ */
+Country Country::load(BinaryReader &in) {
+    std::string n = in.readString();
+    std::string id = in.readString();
+
+    auto provinceCount = in.read<std::uint32_t>();
+    if (provinceCount > in.remaining() / Province::MIN_SAVED_BYTES) throw SnapshotException("Numar de provincii invalid pentru " + n);
+    std::vector<Province> provs(provinceCount);
+    for (auto &p: provs) p.load(in);
+
+    auto fuel = in.read<std::int32_t>();
+    auto manpower = in.read<std::int32_t>();
+    Country c(std::move(n), std::move(id), std::move(provs), ResourceStockpile(fuel, manpower));
+    c.equipment.load(in);
+
+    auto lineCount = in.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < lineCount; ++i) {
+        auto type = in.read<std::int32_t>();
+        auto factories = in.read<std::int32_t>();
+        auto efficiency = in.read<std::int32_t>();
+        auto progress = in.read<std::int64_t>();
+        if (!isValidEquipmentType(type) || factories < 0 ||
+            efficiency < 0 || efficiency > ProductionLine::EFFICIENCY_CAP || progress < 0 ||
+            progress >= equipmentInfo(static_cast<EquipmentType>(type)).unitCostMilli)
+            throw SnapshotException("Linie de productie invalida pentru " + c.name);
+        c.milLines.add(static_cast<EquipmentType>(type), factories, efficiency, progress);
+        c.usedMilFactories += factories;
+    }
+
+    auto constructionCount = in.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < constructionCount; ++i) {
+        auto type = in.read<std::int32_t>();
+        auto provinceIndex = in.read<std::int32_t>();
+        auto totalCost = in.read<double>();
+        auto remaining = in.read<double>();
+        // nextEvent() imparte remaining la BP-ul zilnic, deci valorile trebuie sa fie finite si pozitive
+        if (type < 0 || static_cast<std::size_t>(type) >= BUILDING_TYPE_COUNT ||
+            provinceIndex < 0 || static_cast<std::size_t>(provinceIndex) >= c.provinces.size() ||
+            !std::isfinite(totalCost) || !std::isfinite(remaining) || remaining <= 0 || remaining > totalCost)
+            throw SnapshotException("Constructie invalida pentru " + c.name);
+        c.constructions.add(Construction(static_cast<BuildingType>(type), provinceIndex, totalCost, remaining));
+        c.queuedCounts[provinceIndex][static_cast<std::size_t>(type)]++;
+    }
+    c.constructionSlotCap = in.read<double>();
+    if (!std::isfinite(c.constructionSlotCap) || c.constructionSlotCap <= 0)
+        throw SnapshotException("Plafon de constructie invalid pentru " + c.name);
+
+    c.focusTree.load(in);
+
+    c.elapsedDays = in.read<std::int32_t>();
+    if (c.elapsedDays < 0) throw SnapshotException("Zi invalida pentru " + c.name);
+
+    c.checkAggregates();
+    return c;
+}
+
 /**
  * @brief Operator de stream pentru afisarea unui Country.
  * @param os Stream-ul de iesire.
@@ -1,57 +1,370 @@
 #include "../headers/Engine.h"
+#include "../headers/CommandJournal.h"
 #include "../headers/CountryBuilder.h"
 #include "../headers/ResourceBase.h"
-#include <cstdlib>
-#include <ctime>
-#include <iostream>
+#include "../headers/GameExceptions.h"
+#include "../headers/BinaryIO.h"
+#include "../headers/Profiler.h"
+#include "../headers/ScenarioFile.h"
+#include "../headers/WorldGenerator.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
 
-Engine::Engine() {
-    std::srand((unsigned) std::time(nullptr));
-    init();
+Engine::Engine() : Engine("default") {
 }
 
-void Engine::init() {
-    Province p1("Wallachia", 1800, 3, 3, 6, 5, 3, 4, 1, 3);
-    Province p2("Moldavia", 1500, 2, 2, 5, 4, 2, 3, 1, 2);
-    Province p3("Transylvania", 1600, 2, 1, 7, 8, 5, 6, 3, 1);
+Engine::Engine(const std::string &scenario, std::uint64_t seed, const SimulationParams &params)
+    : scenarioName(scenario), seed(seed), params(params) {
+    this->params.validate();
+    loadScenario(scenario);
+    for (auto &c: countries) c.setParams(this->params);
+    seedCountries();
+    resetSchedule();
+}
+
+void Engine::seedCountries() {
+    for (std::size_t i = 0; i < countries.size(); ++i) {
+        countries[i].seedRandom(seed, static_cast<std::uint32_t>(i));
+    }
+}
+
+void Engine::setWorkerCount(unsigned workers) {
+    if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+    if (workers <= 1) {
+        pool.reset();
+        return;
+    }
+    if (pool && pool->concurrency() == workers) return;
+    pool = std::make_unique<ThreadPool>(workers - 1);
+}
+
+// "default" este scenariul construit in cod, "synthetic:..." o lume generata (WorldGenerator);
+// orice alt nume este calea catre un fisier de scenariu (ScenarioFile).
+void Engine::loadScenario(const std::string &scenario) {
+    if (scenario == "default") {
+        init();
+        return;
+    }
+    if (scenario.starts_with(WorldGenerator::SCENARIO_PREFIX)) {
+        countries = WorldGenerator::generate(WorldGenerator::parseSpec(scenario), params);
+        return;
+    }
+    countries = ScenarioFile::load(scenario);
+}
+
+void Engine::exportScenario(const std::string &path) {
+    ScenarioFile::save(path, getCountries());
+}
 
+void Engine::init() {
     CountryBuilder roBuilder;
-    Country Romania = roBuilder
-            .setName("Romania")
+    roBuilder.setName("Romania")
             .setIdeology("Democratic")
             .setStockpile(0, 100)
-            .addProvince(p1)
-            .addProvince(p2)
-            .addProvince(p3)
-            .build();
+            .reserveProvinces(3)
+            .emplaceProvince("Wallachia", 1800, 3, 3, 6, 5, 3, 4, 1, 3)
+            .emplaceProvince("Moldavia", 1500, 2, 2, 5, 4, 2, 3, 1, 2)
+            .emplaceProvince("Transylvania", 1600, 2, 1, 7, 8, 5, 6, 3, 1);
+    Country Romania = std::move(roBuilder).build();
 
     Romania.addProductionLine(EquipmentType::Gun);
 
-    Province h1("Alfold", 1400, 2, 2, 6, 4, 2, 3, 1, 2);
-    Province h2("Transdanubia", 1200, 2, 1, 6, 3, 2, 2, 1, 1);
-
     CountryBuilder huBuilder;
-    Country Hungary = huBuilder
-            .setName("Hungary")
+    huBuilder.setName("Hungary")
             .setIdeology("Authoritarian")
             .setStockpile(0, 80)
-            .addProvince(h1)
-            .addProvince(h2)
-            .build();
-
+            .reserveProvinces(2)
+            .emplaceProvince("Alfold", 1400, 2, 2, 6, 4, 2, 3, 1, 2)
+            .emplaceProvince("Transdanubia", 1200, 2, 1, 6, 3, 2, 2, 1, 1);
+    Country Hungary = std::move(huBuilder).build();
 
     Hungary.addProductionLine(EquipmentType::Artillery);
 
     countries.clear();
-    countries.push_back(Romania);
-    countries.push_back(Hungary);
+    countries.reserve(2);
+    countries.push_back(std::move(Romania));
+    countries.push_back(std::move(Hungary));
+}
+
+void Engine::resetSchedule() {
+    syncedDay.assign(countries.size(), day);
+    // versiunile nu sunt resetate: starea noua trebuie sa para modificata fata de orice citire anterioara
+    countryVersions.resize(countries.size());
+    for (auto &v: countryVersions) ++v;
+    scheduler.reset(countries.size());
+    for (std::size_t i = 0; i < countries.size(); ++i) {
+        reschedule(static_cast<int>(i));
+    }
+}
+
+void Engine::syncCountry(int countryIndex) {
+    int &synced = syncedDay[countryIndex];
+    if (synced < day) {
+        countries[countryIndex].fastForward(day - synced);
+        synced = day;
+        ++countryVersions[countryIndex];
+    }
+}
 
-    std::cout << "=== INITIAL STATE ===\n";
+void Engine::reschedule(int countryIndex) {
+    CountryEvent next = countries[countryIndex].nextEvent();
+    if (next.kind == CountryEventKind::None) {
+        scheduler.cancel(countryIndex);
+        return;
+    }
+    scheduler.schedule(countryIndex, static_cast<long long>(syncedDay[countryIndex]) + next.days, next.kind);
+}
+
+// Simuleaza complet ziua curenta pentru tarile care au un eveniment programat azi; celelalte nu costa nimic.
+void Engine::processDueEvents() {
+    PROFILE_SCOPE("engine.processDueEvents");
+    std::vector<ScheduledEvent> due = scheduler.popDue(day);
+    if (due.empty()) return;
+
+    auto step = [this, &due](std::size_t i) {
+        int ci = due[i].countryIndex;
+        countries[ci].fastForward(day - 1 - syncedDay[ci]);
+        countries[ci].simulateDay();
+        syncedDay[ci] = day;
+        ++countryVersions[ci];
+    };
+    // tarile nu isi modifica reciproc starea in timpul unei zile, deci ordinea pasilor nu conteaza
+    if (pool) {
+        pool->parallelFor(due.size(), step);
+    } else {
+        for (std::size_t i = 0; i < due.size(); ++i) step(i);
+    }
+
+    for (const auto &e: due) {
+        reschedule(e.countryIndex);
+    }
 }
 
 void Engine::simulateOneDay() {
     ++day;
-    for (auto &c: countries) {
-        c.simulateDay();
+    processDueEvents();
+    if (telemetry) recordTelemetry();
+}
+
+// Aduce toate tarile la ziua curenta si adauga starea lor in telemetrie. Randurile sunt completate in
+// paralel (fiecare tara isi scrie doar randul ei), apoi trimise writer-ului in ordinea tarilor.
+void Engine::recordTelemetry() {
+    PROFILE_SCOPE("engine.telemetry");
+    telemetryRows.resize(countries.size());
+    auto capture = [this](std::size_t i) {
+        syncCountry(static_cast<int>(i));
+        const Country &c = countries[i];
+        TelemetryRecord &r = telemetryRows[i];
+        r.day = day;
+        r.country = static_cast<std::int32_t>(i);
+        r.fuel = c.getResourceStockpile().getFuel();
+        r.manpower = c.getResourceStockpile().getManpower();
+        r.civFactories = c.totalCiv();
+        r.milFactories = c.totalMil();
+        r.usedMilFactories = c.getUsedMilFactories();
+        r.queuedConstructions = static_cast<std::int32_t>(c.getConstructionQueue().size());
+        const auto &counts = c.getEquipment().getCounts();
+        for (std::size_t e = 0; e < EQUIPMENT_TYPE_COUNT; ++e) r.equipment[e] = counts[e];
+    };
+    if (pool) {
+        pool->parallelFor(countries.size(), capture);
+    } else {
+        for (std::size_t i = 0; i < countries.size(); ++i) capture(i);
+    }
+    for (const auto &r: telemetryRows) telemetry->append(r);
+}
+
+void Engine::simulateDays(int days) {
+    for (int i = 0; i < days; ++i) {
+        simulateOneDay();
+    }
+}
+
+// Acelasi rezultat ca simulateDays(days), dar sare direct de la un eveniment programat la urmatorul.
+// Costul este proportional cu numarul de evenimente, nu cu numarul de zile (cu exceptia cazului in care
+// telemetria este activa, care are nevoie de fiecare zi).
+void Engine::advance(int days) {
+    if (days <= 0) return;
+    if (telemetry) {
+        simulateDays(days);
+        return;
+    }
+    long long target = static_cast<long long>(day) + days;
+    for (long long next = scheduler.nextDay(); next <= target; next = scheduler.nextDay()) {
+        day = static_cast<int>(next);
+        processDueEvents();
+    }
+    day = static_cast<int>(target);
+}
+
+namespace {
+    constexpr char SNAPSHOT_MAGIC[8] = {'O', 'O', 'P', 'S', 'N', 'A', 'P', '\0'};
+    // scris in ordinea nativa a octetilor; la citire pe o masina cu alt endianness nu se potriveste
+    constexpr std::uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304u;
+}
+
+// Toata starea este serializata intr-un buffer si scrisa dintr-o singura operatie; tarile sunt aduse
+// la zi inainte, deci snapshot-ul nu contine nimic legat de planificarea evenimentelor.
+void Engine::saveSnapshot(const std::string &path) {
+    getCountries();
+
+    BinaryWriter out;
+    out.writeArray(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    out.write(SNAPSHOT_VERSION);
+    out.write(SNAPSHOT_BYTE_ORDER);
+    out.write(static_cast<std::int32_t>(day));
+    out.write(seed);
+    out.write(static_cast<std::uint32_t>(countries.size()));
+    for (const auto &c: countries) c.save(out);
+    out.saveToFile(path);
+}
+
+// Starea curenta este inlocuita doar daca intregul fisier a fost citit cu succes.
+void Engine::setJournal(CommandJournal *target) {
+    if (target && loadedFromSnapshot)
+        throw JournalException("Sesiunile pornite dintr-un snapshot nu pot fi inregistrate");
+    journal = target;
+}
+
+void Engine::loadSnapshot(const std::string &path) {
+    if (journal) throw JournalException("Un snapshot nu poate fi incarcat in timpul inregistrarii");
+    std::vector<char> data = BinaryReader::loadFile(path);
+    BinaryReader in(data.data(), data.size());
+
+    char magic[sizeof(SNAPSHOT_MAGIC)];
+    in.readArray(magic, sizeof(magic));
+    if (std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0)
+        throw SnapshotException(path + " nu este un snapshot");
+    auto version = in.read<std::uint32_t>();
+    if (version != SNAPSHOT_VERSION)
+        throw SnapshotException("Versiune de snapshot nesuportata: " + std::to_string(version));
+    if (in.read<std::uint32_t>() != SNAPSHOT_BYTE_ORDER)
+        throw SnapshotException("Snapshot scris pe o platforma cu alta ordine a octetilor");
+
+    auto loadedDay = in.read<std::int32_t>();
+    auto loadedSeed = in.read<std::uint64_t>();
+    auto count = in.read<std::uint32_t>();
+    if (loadedDay < 0 || count > in.remaining()) throw SnapshotException("Header de snapshot invalid");
+
+    std::vector<Country> loaded;
+    loaded.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) loaded.push_back(Country::load(in));
+    if (in.remaining() != 0) throw SnapshotException("Date suplimentare la sfarsitul snapshot-ului");
+
+    // parametrii nu fac parte din snapshot; plafonul de slot salvat este insa pastrat
+    for (auto &c: loaded) {
+        double slotCap = c.getConstructionSlotCap();
+        c.setParams(params);
+        c.setConstructionSlotCap(slotCap);
+    }
+
+    countries = std::move(loaded);
+    day = loadedDay;
+    seed = loadedSeed;
+    loadedFromSnapshot = true;
+    seedCountries();
+    resetSchedule();
+}
+
+Country &Engine::mutableCountry(int countryIndex) {
+    if (countryIndex < 0 || static_cast<std::size_t>(countryIndex) >= countries.size()) {
+        throw GameException("Index tara invalid: " + std::to_string(countryIndex));
+    }
+    syncCountry(countryIndex);
+    return countries[countryIndex];
+}
+
+const std::vector<Country> &Engine::getCountries() {
+    for (std::size_t i = 0; i < countries.size(); ++i) {
+        syncCountry(static_cast<int>(i));
+    }
+    return countries;
+}
+
+const Country &Engine::getCountry(int countryIndex) {
+    return mutableCountry(countryIndex);
+}
+
+std::uint64_t Engine::getCountryVersion(int countryIndex) {
+    mutableCountry(countryIndex);
+    return countryVersions[countryIndex];
+}
+
+const Country &Engine::peekCountry(int countryIndex) const {
+    if (countryIndex < 0 || static_cast<std::size_t>(countryIndex) >= countries.size()) {
+        throw GameException("Index tara invalid: " + std::to_string(countryIndex));
+    }
+    return countries[countryIndex];
+}
+
+std::uint64_t Engine::peekCountryVersion(int countryIndex) const {
+    peekCountry(countryIndex);
+    return countryVersions[countryIndex];
+}
+
+int Engine::getSyncedDay(int countryIndex) const {
+    peekCountry(countryIndex);
+    return syncedDay[countryIndex];
+}
+
+std::uint32_t Engine::getProvinceVersion(int countryIndex, int provinceIndex) {
+    const Country &c = mutableCountry(countryIndex);
+    if (provinceIndex < 0 || static_cast<std::size_t>(provinceIndex) >= c.getProvinces().size()) {
+        throw GameException("Index provincie invalid: " + std::to_string(provinceIndex));
+    }
+    return c.getProvinceVersion(provinceIndex);
+}
+
+void Engine::startFocus(int countryIndex, int focusIndex) {
+    FocusStartResult result = mutableCountry(countryIndex).startFocus(focusIndex);
+    if (result != FocusStartResult::Started) throw GameException(focusStartMessage(result));
+    ++countryVersions[countryIndex];
+    reschedule(countryIndex);
+}
+
+void Engine::addConstruction(int countryIndex, BuildingType type, int provinceIndex, int count) {
+    mutableCountry(countryIndex).addConstruction(type, provinceIndex, count);
+    ++countryVersions[countryIndex];
+    reschedule(countryIndex);
+}
+
+void Engine::addProductionLine(int countryIndex, EquipmentType type) {
+    // liniile de productie nu genereaza evenimente, dar schimba ritmul liniar aplicat de fastForward,
+    // de aceea tara este sincronizata inainte de modificare (in mutableCountry)
+    mutableCountry(countryIndex).addProductionLine(type);
+    ++countryVersions[countryIndex];
+}
+
+void Engine::modifyLineFactories(int countryIndex, int lineIndex, int amount) {
+    mutableCountry(countryIndex).modifyLineFactories(lineIndex, amount);
+    ++countryVersions[countryIndex];
+}
+
+void Engine::dispatch(const EngineCommand &command) {
+    switch (command.type) {
+        case CommandType::StartFocus:
+            startFocus(command.country, command.arg0);
+            return;
+        case CommandType::AddConstruction:
+            if (command.arg0 < 0 || static_cast<std::size_t>(command.arg0) >= BUILDING_TYPE_COUNT)
+                throw GameException("Tip de cladire invalid: " + std::to_string(command.arg0));
+            addConstruction(command.country, static_cast<BuildingType>(command.arg0), command.arg1, command.arg2);
+            return;
+        case CommandType::AddProductionLine:
+            if (!isValidEquipmentType(command.arg0))
+                throw GameException("Tip de echipament invalid: " + std::to_string(command.arg0));
+            addProductionLine(command.country, static_cast<EquipmentType>(command.arg0));
+            return;
+        case CommandType::ModifyLineFactories:
+            modifyLineFactories(command.country, command.arg0, command.arg1);
+            return;
     }
+    throw GameException("Comanda necunoscuta");
+}
+
+void Engine::execute(const EngineCommand &command) {
+    dispatch(command);
+    // doar comenzile acceptate ajung in jurnal; cele refuzate nu au modificat starea
+    if (journal) journal->record(day, command);
 }
@@ -1,47 +1,42 @@
 #include "EquipmentStockpile.h"
+#include "BinaryIO.h"
+#include <cstdint>
 #include <sstream>
 
-void EquipmentStockpile::addGuns(long long n) {
-    if (n > 0) guns += n;
+void EquipmentStockpile::add(EquipmentType t, long long n) {
+    if (n > 0) counts[equipmentIndex(t)] += n;
 }
 
-void EquipmentStockpile::addArtillery(long long n) {
-    if (n > 0) artillery += n;
-}
-
-void EquipmentStockpile::addAntiAir(long long n) {
-    if (n > 0) antiAir += n;
-}
-
-void EquipmentStockpile::addCAS(long long n) {
-    if (n > 0) cas += n;
-}
-
-long long EquipmentStockpile::getGuns() const {
-    return guns;
-}
-
-long long EquipmentStockpile::getArtillery() const {
-    return artillery;
-}
-
-long long EquipmentStockpile::getAntiAir() const {
-    return antiAir;
-}
-
-long long EquipmentStockpile::getCAS() const {
-    return cas;
+void EquipmentStockpile::addAll(const Counts &produced) {
+    for (std::size_t i = 0; i < EQUIPMENT_TYPE_COUNT; ++i) {
+        counts[i] += produced[i] > 0 ? produced[i] : 0;
+    }
 }
 
 std::string EquipmentStockpile::toString() const {
     std::ostringstream ss;
-    ss << "Guns=" << getGuns()
-            << ", Artillery=" << getArtillery()
-            << ", AA=" << getAntiAir()
-            << ", CAS=" << getCAS();
+    for (std::size_t i = 0; i < EQUIPMENT_TYPE_COUNT; ++i) {
+        if (i > 0) ss << ", ";
+        ss << EQUIPMENT_CATALOG[i].shortName << "=" << counts[i];
+    }
     return ss.str();
 }
 
 std::ostream &operator<<(std::ostream &os, const EquipmentStockpile &e) {
     return os << e.toString();
 }
+
+void EquipmentStockpile::save(BinaryWriter &out) const {
+    std::array<std::int64_t, EQUIPMENT_TYPE_COUNT> raw{};
+    for (std::size_t i = 0; i < EQUIPMENT_TYPE_COUNT; ++i) raw[i] = counts[i];
+    out.writeArray(raw.data(), raw.size());
+}
+
+void EquipmentStockpile::load(BinaryReader &in) {
+    std::array<std::int64_t, EQUIPMENT_TYPE_COUNT> raw{};
+    in.readArray(raw.data(), raw.size());
+    for (std::int64_t n: raw) {
+        if (n < 0) throw SnapshotException("Stoc de echipament negativ in snapshot");
+    }
+    for (std::size_t i = 0; i < EQUIPMENT_TYPE_COUNT; ++i) counts[i] = raw[i];
+}
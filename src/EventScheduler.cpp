@@ -0,0 +1,37 @@
+#include "../headers/EventScheduler.h"
+
+void EventScheduler::reset(std::size_t countryCount) {
+    queue = {};
+    generations.assign(countryCount, 0);
+}
+
+void EventScheduler::schedule(int countryIndex, long long day, CountryEventKind kind) {
+    std::uint32_t gen = ++generations[countryIndex];
+    queue.push(ScheduledEvent{day, countryIndex, kind, gen});
+}
+
+void EventScheduler::cancel(int countryIndex) {
+    ++generations[countryIndex];
+}
+
+void EventScheduler::dropStale() {
+    while (!queue.empty() && queue.top().generation != generations[queue.top().countryIndex]) {
+        queue.pop();
+    }
+}
+
+long long EventScheduler::nextDay() {
+    dropStale();
+    return queue.empty() ? NEVER : queue.top().day;
+}
+
+std::vector<ScheduledEvent> EventScheduler::popDue(long long day) {
+    std::vector<ScheduledEvent> due;
+    for (dropStale(); !queue.empty() && queue.top().day <= day; dropStale()) {
+        due.push_back(queue.top());
+        queue.pop();
+        // evenimentul a fost consumat; tara trebuie reprogramata explicit
+        ++generations[due.back().countryIndex];
+    }
+    return due;
+}
@@ -7,13 +7,14 @@
  *  - clasa FocusTree: colectia de focus-uri, focus-ul activ (index) si progresul acestuia
  *
  * Flux:
- *  - startFocus(index): porneste un focus daca nu exista deja unul activ si daca indexul e valid/necompletat
+ *  - startFocus(index): porneste un focus daca nu exista deja unul activ si daca indexul e valid/necompletat;
+ *                      intoarce motivul refuzului (FocusStartResult), fara a scrie la consola
  *  - tickRaw(): avanseaza progresul cu 1 zi; cand se finalizeaza, marcheaza focus-ul completat si
  *               returneaza efectul (int) pentru a fi aplicat de logica jocului (ex: Country::simulateDay)
  */
 
 #include "../headers/FocusTree.h"
-#include <iostream>
+#include "../headers/BinaryIO.h"
 
 /**
  * @brief Construieste un focus individual.
@@ -21,15 +22,15 @@
  * @param daysRequired Numarul de zile necesare pentru completare.
  * @param effect Efectul aplicat la completare (FocusEffectType).
  */
-Focus::Focus(std::string name, int daysRequired, FocusEffectType effect)
-    : name_(std::move(name)), daysRequired_(daysRequired), effect_(effect) {
+Focus::Focus(std::string_view name, int daysRequired, FocusEffectType effect)
+    : name_(name), daysRequired_(daysRequired), effect_(effect) {
 }
 
 /**
  * @brief Returneaza numele focus-ului.
- * @return Referinta const la string-ul numelui.
+ * @return Numele (view catre un literal static).
  */
-const std::string &Focus::name() const { return name_; }
+std::string_view Focus::name() const { return name_; }
 
 /**
  * @brief Returneaza numarul de zile necesare pentru completare.
@@ -37,6 +38,12 @@ const std::string &Focus::name() const { return name_; }
  */
 int Focus::days() const { return daysRequired_; }
 
+/**
+ * @brief Schimba numarul de zile necesare pentru completare.
+ * @param days Zilele necesare (>= 1).
+ */
+void Focus::setDays(int days) { daysRequired_ = days; }
+
 /**
  * @brief Returneaza efectul focus-ului.
  * @return Tipul efectului asociat focus-ului.
@@ -53,11 +60,39 @@ void Focus::markCompleted() { completed_ = true; }
  *
  * Defineste 4 focus-uri, fiecare cu durata (zile) si efect diferit.
  */
-FocusTree::FocusTree() {
-    focuses.emplace_back("Industrial Expansion", 35, FocusEffectType::AddCiv);
-    focuses.emplace_back("Military Buildup", 35, FocusEffectType::AddMil);
-    focuses.emplace_back("Infrastructure Effort", 25, FocusEffectType::AddInfra);
-    focuses.emplace_back("Dockyard Development", 30, FocusEffectType::AddDockyard);
+FocusTree::FocusTree()
+    : focuses{
+        Focus("Industrial Expansion", 35, FocusEffectType::AddCiv),
+        Focus("Military Buildup", 35, FocusEffectType::AddMil),
+        Focus("Infrastructure Effort", 25, FocusEffectType::AddInfra),
+        Focus("Dockyard Development", 30, FocusEffectType::AddDockyard)
+    } {
+}
+
+/**
+ * @brief Suprascrie duratele din catalog (vezi SimulationParams::focusDays).
+ *
+ * Un focus activ care si-a depasit deja noua durata se finalizeaza la urmatorul tickRaw().
+ *
+ * @param days Zilele necesare pentru fiecare focus, in ordinea din constructor.
+ */
+void FocusTree::setDurations(const std::array<int, FOCUS_COUNT> &days) {
+    for (std::size_t i = 0; i < FOCUS_COUNT; ++i) focuses[i].setDays(days[i]);
+}
+
+/**
+ * @brief Mesajul corespunzator rezultatului unei porniri de focus.
+ * @param result Rezultatul intors de FocusTree::startFocus.
+ * @return Text static, potrivit pentru afisare.
+ */
+const char *focusStartMessage(FocusStartResult result) {
+    switch (result) {
+        case FocusStartResult::Started: return "Focus started";
+        case FocusStartResult::AlreadyRunning: return "A focus is already running";
+        case FocusStartResult::InvalidIndex: return "Invalid focus index";
+        case FocusStartResult::AlreadyCompleted: return "Focus already completed";
+    }
+    return "Unknown focus result";
 }
 
 /**
@@ -68,30 +103,21 @@ FocusTree::FocusTree() {
  *  - index trebuie sa fie in [0, focuses.size())
  *  - focus-ul nu trebuie sa fie deja completat
  *
- * Daca porneste, reseteaza progresul la 0 si seteaza currentIndex.
+ * Daca porneste, reseteaza progresul la 0 si seteaza currentIndex. Functia este apelata si de pe
+ * thread-urile simularii, deci nu scrie la consola; apelantul decide cum raporteaza un refuz.
  *
  * @param index Indexul focus-ului din vectorul intern.
- * @return true daca a pornit cu succes, false altfel.
+ * @return Started daca a pornit, altfel motivul refuzului.
  */
-bool FocusTree::startFocus(int index) {
-    if (currentIndex != -1) {
-        std::cerr << "[!] A focus is already running.\n";
-        return false;
-    }
-    if (index < 0 || index >= static_cast<int>(focuses.size())) {
-        std::cerr << "[!] Invalid focus index.\n";
-        return false;
-    }
+FocusStartResult FocusTree::startFocus(int index) {
+    if (currentIndex != -1) return FocusStartResult::AlreadyRunning;
+    if (index < 0 || index >= static_cast<int>(focuses.size())) return FocusStartResult::InvalidIndex;
     // Daca e deja completat, nu il mai putem face
-    if (focuses[index].isCompleted()) {
-        std::cerr << "[!] Focus already completed.\n";
-        return false;
-    }
+    if (focuses[index].isCompleted()) return FocusStartResult::AlreadyCompleted;
 
     currentIndex = index;
     progress = 0;
-    std::cout << "[FOCUS] Started: " << focuses[index].name() << "\n";
-    return true;
+    return FocusStartResult::Started;
 }
 
 /**
@@ -99,7 +125,7 @@ bool FocusTree::startFocus(int index) {
  * @return String cu numele focus-ului activ sau "None".
  */
 std::string FocusTree::getActiveFocusName() const {
-    return currentIndex == -1 ? "None" : focuses[currentIndex].name();
+    return currentIndex == -1 ? "None" : std::string(focuses[currentIndex].name());
 }
 
 /**
@@ -119,9 +145,66 @@ int FocusTree::tickRaw() {
     if (progress >= focuses[currentIndex].days()) {
         auto eff = static_cast<int>(focuses[currentIndex].effect());
         focuses[currentIndex].markCompleted();
-        std::cout << "[FOCUS COMPLETED] " << focuses[currentIndex].name() << "\n";
         currentIndex = -1;
         return eff;
     }
     return -1;
 }
+
+/**
+ * @brief Returneaza in cate zile se finalizeaza focus-ul activ.
+ *
+ * Valoarea k inseamna ca al k-lea apel tickRaw() de acum inainte va finaliza focus-ul.
+ *
+ * @return Zilele ramase (>= 1) sau -1 daca nu exista focus activ.
+ */
+int FocusTree::daysRemaining() const {
+    if (currentIndex == -1) return -1;
+    int left = focuses[currentIndex].days() - progress;
+    return left < 1 ? 1 : left;
+}
+
+/**
+ * @brief Avanseaza progresul focus-ului activ cu mai multe zile deodata, fara a-l finaliza.
+ *
+ * Echivalent cu `days` apeluri tickRaw() care intorc -1; apelantul trebuie sa se asigure ca
+ * days < daysRemaining().
+ *
+ * @param days Numarul de zile de avansat.
+ */
+void FocusTree::advance(int days) {
+    if (currentIndex == -1 || days <= 0) return;
+    progress += days;
+}
+
+/**
+ * @brief Scrie starea arborelui (focus activ, progres, focus-uri completate) in formatul binar.
+ *
+ * Lista de focus-uri este fixa (definita in constructor), deci se salveaza doar starea ei.
+ *
+ * @param out Buffer-ul de iesire.
+ */
+void FocusTree::save(BinaryWriter &out) const {
+    out.write(static_cast<std::int32_t>(currentIndex));
+    out.write(static_cast<std::int32_t>(progress));
+    out.write(static_cast<std::uint32_t>(focuses.size()));
+    for (const auto &f: focuses) out.write(static_cast<std::uint8_t>(f.isCompleted()));
+}
+
+/**
+ * @brief Restaureaza starea scrisa cu save() intr-un FocusTree proaspat construit.
+ * @param in Cititorul binar.
+ * @throws SnapshotException daca snapshot-ul nu corespunde listei de focus-uri.
+ */
+void FocusTree::load(BinaryReader &in) {
+    auto index = in.read<std::int32_t>();
+    auto prog = in.read<std::int32_t>();
+    auto count = in.read<std::uint32_t>();
+    if (count != focuses.size() || index < -1 || index >= static_cast<int>(focuses.size()) || prog < 0)
+        throw SnapshotException("Focus tree invalid in snapshot");
+    for (auto &f: focuses) {
+        if (in.read<std::uint8_t>() != 0) f.markCompleted();
+    }
+    currentIndex = index;
+    progress = prog;
+}
@@ -12,8 +12,46 @@
 
 #include "../headers/Interface.h"
 #include "../headers/GameExceptions.h"
+#include "../headers/Profiler.h"
 #include <iostream>
 
+namespace {
+    constexpr float PROVINCE_ICON_SCALE = 0.5f;
+    constexpr unsigned PROVINCE_VALUE_SIZE = 16;
+
+    // doua triunghiuri pentru un dreptunghi texturat (sf::Quads nu exista pe OpenGL ES / SFML 3)
+    void appendQuad(sf::VertexArray& va, sf::FloatRect dst, sf::FloatRect tex, sf::Color color) {
+        sf::Vertex tl({ dst.left, dst.top }, color, { tex.left, tex.top });
+        sf::Vertex tr({ dst.left + dst.width, dst.top }, color, { tex.left + tex.width, tex.top });
+        sf::Vertex bl({ dst.left, dst.top + dst.height }, color, { tex.left, tex.top + tex.height });
+        sf::Vertex br({ dst.left + dst.width, dst.top + dst.height }, color, { tex.left + tex.width, tex.top + tex.height });
+        va.append(tl); va.append(tr); va.append(bl);
+        va.append(bl); va.append(tr); va.append(br);
+    }
+
+    // aceleasi glife si aceeasi asezare ca sf::Text, dar adaugate intr-un lot comun
+    // (toate glifele unei marimi de font sunt in aceeasi textura)
+    void appendText(sf::VertexArray& va, const sf::Font& font, const std::string& str, sf::Vector2f pos,
+                    unsigned size, sf::Color color) {
+        const float padding = 1.f;
+        float x = pos.x;
+        float y = pos.y + static_cast<float>(size);
+        sf::Uint32 prev = 0;
+        for (char ch : str) {
+            auto cp = static_cast<sf::Uint32>(static_cast<unsigned char>(ch));
+            x += font.getKerning(prev, cp, size);
+            const sf::Glyph& g = font.getGlyph(cp, size, false);
+            sf::FloatRect dst(x + g.bounds.left - padding, y + g.bounds.top - padding,
+                              g.bounds.width + 2 * padding, g.bounds.height + 2 * padding);
+            sf::FloatRect tex(static_cast<float>(g.textureRect.left) - padding, static_cast<float>(g.textureRect.top) - padding,
+                              static_cast<float>(g.textureRect.width) + 2 * padding, static_cast<float>(g.textureRect.height) + 2 * padding);
+            appendQuad(va, dst, tex, color);
+            x += g.advance;
+            prev = cp;
+        }
+    }
+}
+
 /**
  * @brief Construieste interfata grafica si incarca toate resursele (texturi, fonturi).
  *
@@ -22,12 +60,13 @@
  * Initializeaza textele si sprite-urile folosite in UI, apoi apeleaza functiile de setup
  * pentru diversele panouri.
  *
- * @param eng Referinta la Engine-ul jocului (folosit pentru citire si modificari).
+ * @param eng Engine-ul jocului; dupa pornirea buclei (run) este folosit doar de thread-ul simularii.
  * @param title Titlul ferestrei.
  *
  * @throws AssetLoadException daca harta (images/harta.png) nu se poate incarca.
  */
-Interface::Interface(Engine& eng, const std::string& title) : engine(eng) {
+Interface::Interface(Engine& eng, const std::string& title)
+    : simulation(eng, DAY_DURATION), snapshot(simulation.snapshot()) {
     sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
     window.create(desktop, title, sf::Style::Fullscreen);
     window.setFramerateLimit(60);
@@ -51,26 +90,21 @@ Interface::Interface(Engine& eng, const std::string& title) : engine(eng) {
     alertText.setOutlineThickness(1.f);
     alertText.setPosition(desktop.width / 2.f - 150.f, 60.f);
 
-    if (!steelTex.loadFromFile("images/steel.png")) std::cerr << "Lipseste steel.png\n";
-    if (!tungstenTex.loadFromFile("images/tungsten.png")) std::cerr << "Lipseste tungsten.png\n";
-    if (!aluminumTex.loadFromFile("images/aluminum.png")) std::cerr << "Lipseste aluminum.png\n";
-    if (!chromiumTex.loadFromFile("images/chromium.png")) std::cerr << "Lipseste chromium.png\n";
-    if (!oilTex.loadFromFile("images/oil.png")) std::cerr << "Lipseste oil.png\n";
-    if (!civTex.loadFromFile("images/civ.png")) std::cerr << "Lipseste civ.png\n";
-    if (!milTex.loadFromFile("images/mil.png")) std::cerr << "Lipseste mil.png\n";
-    if (!infraTex.loadFromFile("images/infra.png")) std::cerr << "Lipseste infra.png\n";
-    if (!dockyardTex.loadFromFile("images/dockyard.png")) std::cerr << "Lipseste dockyard.png\n";
-    if (!airfieldTex.loadFromFile("images/airfield.png")) std::cerr << "Lipseste airfield.png\n";
-    if (!manpowerTex.loadFromFile("images/manpower.png")) std::cerr << "Lipseste manpower.png\n";
-    if (!fuelStockTex.loadFromFile("images/fuel_stockpile.png")) std::cerr << "Lipseste fuel.png\n";
-
-    roFuelSprite.setTexture(fuelStockTex); roFuelSprite.setScale(0.6f, 0.6f); roFuelSprite.setPosition(20.f, 60.f);
-    roManpowerSprite.setTexture(manpowerTex); roManpowerSprite.setScale(0.6f, 0.6f); roManpowerSprite.setPosition(20.f, 100.f);
+    atlas.build({
+        "images/steel.png", "images/tungsten.png", "images/aluminum.png", "images/chromium.png", "images/oil.png",
+        "images/civ.png", "images/mil.png", "images/infra.png", "images/dockyard.png", "images/airfield.png",
+        "images/manpower.png", "images/fuel_stockpile.png",
+        "images/gun.png", "images/artillery.png", "images/antiair.png", "images/cas.png",
+        "images/plus.png", "images/minus.png"
+    });
+
+    setAtlasSprite(roFuelSprite, AtlasIcon::FuelStock, 0.f); roFuelSprite.setScale(0.6f, 0.6f); roFuelSprite.setPosition(20.f, 60.f);
+    setAtlasSprite(roManpowerSprite, AtlasIcon::Manpower, 0.f); roManpowerSprite.setScale(0.6f, 0.6f); roManpowerSprite.setPosition(20.f, 100.f);
     roFuelText.setFont(font); roFuelText.setCharacterSize(18); roFuelText.setPosition(60.f, 60.f); roFuelText.setString("0");
     roManpowerText.setFont(font); roManpowerText.setCharacterSize(18); roManpowerText.setPosition(60.f, 100.f); roManpowerText.setString("0");
 
-    huFuelSprite.setTexture(fuelStockTex); huFuelSprite.setScale(0.6f, 0.6f); huFuelSprite.setPosition(20.f, 60.f);
-    huManpowerSprite.setTexture(manpowerTex); huManpowerSprite.setScale(0.6f, 0.6f); huManpowerSprite.setPosition(20.f, 100.f);
+    setAtlasSprite(huFuelSprite, AtlasIcon::FuelStock, 0.f); huFuelSprite.setScale(0.6f, 0.6f); huFuelSprite.setPosition(20.f, 60.f);
+    setAtlasSprite(huManpowerSprite, AtlasIcon::Manpower, 0.f); huManpowerSprite.setScale(0.6f, 0.6f); huManpowerSprite.setPosition(20.f, 100.f);
     huFuelText.setFont(font); huFuelText.setCharacterSize(18); huFuelText.setPosition(60.f, 60.f); huFuelText.setString("0");
     huManpowerText.setFont(font); huManpowerText.setCharacterSize(18); huManpowerText.setPosition(60.f, 100.f); huManpowerText.setString("0");
 
@@ -91,13 +125,6 @@ Interface::Interface(Engine& eng, const std::string& title) : engine(eng) {
         focusNameTexts[i].setOutlineThickness(2.f);
     }
 
-    if (!gunTex.loadFromFile("images/gun.png")) std::cerr << "Lipseste gun.png\n";
-    if (!artTex.loadFromFile("images/artillery.png")) std::cerr << "Lipseste artillery.png\n";
-    if (!aaTex.loadFromFile("images/antiair.png")) std::cerr << "Lipseste antiair.png\n";
-    if (!casTex.loadFromFile("images/cas.png")) std::cerr << "Lipseste cas.png\n";
-    if (!plusTex.loadFromFile("images/plus.png")) std::cerr << "Lipseste plus.png\n";
-    if (!minusTex.loadFromFile("images/minus.png")) std::cerr << "Lipseste minus.png\n";
-
     setupFocusUI();
     setupProvinceUI();
     setupConstructionUI();
@@ -146,7 +173,7 @@ void Interface::setupConstructionUI() {
     constructionPanel.setOutlineColor(sf::Color::White);
     constructionPanel.setOutlineThickness(2.f);
 
-    sf::Texture* textures[] = { &civTex, &milTex, &infraTex, &dockyardTex, &airfieldTex };
+    AtlasIcon icons[] = { AtlasIcon::Civ, AtlasIcon::Mil, AtlasIcon::Infra, AtlasIcon::Dockyard, AtlasIcon::Airfield };
     std::string names[] = { "Civ Factory", "Mil Factory", "Infrastructure", "Dockyard", "Airfield" };
 
     float startY = 100.f;
@@ -154,10 +181,7 @@ void Interface::setupConstructionUI() {
     float iconSize = 64.f;
 
     for (int i = 0; i < 5; ++i) {
-        buildIcons[i].setTexture(*textures[i]);
-        float sX = iconSize / textures[i]->getSize().x;
-        float sY = iconSize / textures[i]->getSize().y;
-        buildIcons[i].setScale(sX, sY);
+        setAtlasSprite(buildIcons[i], icons[i], iconSize);
         buildIcons[i].setPosition(startX, startY + i * (iconSize + 20.f));
 
         buildIconTexts[i].setFont(font);
@@ -187,15 +211,27 @@ void Interface::setupProductionUI() {
     prodTitleText.setFillColor(sf::Color::White);
     prodTitleText.setStyle(sf::Text::Bold);
 
-    sf::Texture* ptrs[] = { &gunTex, &artTex, &aaTex, &casTex };
+    AtlasIcon icons[] = { AtlasIcon::Gun, AtlasIcon::Artillery, AtlasIcon::AntiAir, AtlasIcon::CAS };
     for(int i=0; i<4; ++i) {
-        addNewIcons[i].setTexture(*ptrs[i]);
-        float sx = 48.f / ptrs[i]->getSize().x;
-        float sy = 48.f / ptrs[i]->getSize().y;
-        addNewIcons[i].setScale(sx, sy);
+        setAtlasSprite(addNewIcons[i], icons[i], 48.f);
     }
 }
 
+/**
+ * @brief Leaga un sprite de o regiune din atlasul de iconite.
+ *
+ * @param sprite Sprite-ul configurat.
+ * @param icon Regiunea din atlas.
+ * @param size Latura (in pixeli) la care este scalata iconita; 0 pastreaza dimensiunea originala.
+ */
+void Interface::setAtlasSprite(sf::Sprite& sprite, AtlasIcon icon, float size) const {
+    const sf::IntRect& rect = atlas.getRegion(static_cast<std::size_t>(icon));
+    sprite.setTexture(atlas.getTexture());
+    sprite.setTextureRect(rect);
+    if (size > 0.f && rect.width > 0 && rect.height > 0)
+        sprite.setScale(size / rect.width, size / rect.height);
+}
+
 /**
  * @brief Returneaza pozitia (pe ecran) pentru un icon statistic intr-o anumita provincie.
  *
@@ -266,14 +302,14 @@ sf::Vector2f Interface::getIconPositionFor(const std::string& countryName, const
  * Populeaza provinceUI (vector 2D) astfel incat randarea si update-ul sa fie rapide.
  */
 void Interface::setupProvinceUI() {
-    const auto& countries = engine.getCountries();
+    const auto& countries = snapshot->countries;
     provinceUI.resize(countries.size());
     clickZones.clear();
 
     for (std::size_t ci = 0; ci < countries.size(); ++ci) {
-        const auto& provs = countries[ci].getProvinces();
+        const auto& provs = countries[ci]->getProvinces();
         provinceUI[ci].resize(provs.size());
-        const std::string& countryName = countries[ci].getName();
+        const std::string& countryName = countries[ci]->getName();
 
         for (std::size_t pi = 0; pi < provs.size(); ++pi) {
             ProvinceUI& pui = provinceUI[ci][pi];
@@ -286,21 +322,12 @@ void Interface::setupProvinceUI() {
             zone.countryIndex = static_cast<int>(ci);
             clickZones.push_back(zone);
 
-            auto makeIcon = [&](StatKind kind, sf::Texture& tex) {
-                ResourceIconUI ui; ui.kind = kind; ui.icon.setTexture(tex); ui.icon.setScale(0.5f, 0.5f);
-                sf::Vector2f pos = getIconPositionFor(countryName, provName, kind);
-                ui.icon.setPosition(pos);
-                ui.value.setFont(font); ui.value.setCharacterSize(16); ui.value.setFillColor(sf::Color::White);
-                ui.value.setString("0"); ui.value.setPosition(pos.x + 32.f, pos.y + 4.f);
-                ui.lastValue = -1;
-                pui.resourceIcons.push_back(ui);
-            };
-
-            makeIcon(StatKind::Steel,    steelTex); makeIcon(StatKind::Tungsten, tungstenTex);
-            makeIcon(StatKind::Aluminum, aluminumTex); makeIcon(StatKind::Chromium, chromiumTex);
-            makeIcon(StatKind::Oil,      oilTex); makeIcon(StatKind::Civ,      civTex);
-            makeIcon(StatKind::Mil,      milTex); makeIcon(StatKind::Infra,    infraTex);
-            makeIcon(StatKind::Dockyard, dockyardTex); makeIcon(StatKind::Airfield, airfieldTex);
+            for (StatKind kind : { StatKind::Steel, StatKind::Tungsten, StatKind::Aluminum, StatKind::Chromium,
+                                   StatKind::Oil, StatKind::Civ, StatKind::Mil, StatKind::Infra,
+                                   StatKind::Dockyard, StatKind::Airfield }) {
+                pui.resourceIcons.push_back({ kind, getIconPositionFor(countryName, provName, kind),
+                                              "0", sf::Color::White, -1 });
+            }
         }
     }
 }
@@ -308,24 +335,41 @@ void Interface::setupProvinceUI() {
 /**
  * @brief Actualizeaza UI-ul (texte/culori) in functie de tara selectata si ziua curenta.
  *
- * Daca nu exista tara selectata, afiseaza jocul ca fiind "PAUSED".
- * Altfel:
- *  - actualizeaza valorile resurselor/cladirilor per provincie
- *  - coloreaza valorile in functie de schimbarea fata de cadrul anterior (verde/rosu/alb)
+ * Apelata la fiecare cadru, dar lucreaza doar cand ceva s-a schimbat. Eticheta zilei este refacuta cand
+ * se schimba ziua sau starea simularii (pornita / oprita), chiar si fara tara selectata. Restul UI-ului
+ * depinde de tara selectata si este refacut cand se schimba ziua, tara sau versiunea ei
+ * (WorldSnapshot::countryVersions). In acest caz:
+ *  - reimprospateaza doar provinciile a caror versiune s-a schimbat (sau care au valori colorate)
+ *  - coloreaza valorile in functie de schimbarea fata de reimprospatarea anterioara (verde/rosu/alb)
  *  - actualizeaza fuel/manpower pentru tara curenta
  *  - construieste mesajele de alerta (focus/constructii/fabrici militare libere)
  */
 void Interface::updateUI() {
-    if (selectedCountryIndex == -1) { dayText.setString("Day: " + std::to_string(engine.getDay()) + " (PAUSED)"); return; }
-    dayText.setString("Day: " + std::to_string(engine.getDay()) + " (Running)");
+    if (dayTextDirty || snapshot->day != shownDay) {
+        dayTextDirty = false;
+        shownDay = snapshot->day;
+        dayText.setString("Day: " + std::to_string(shownDay) + (shownRunning ? " (Running)" : " (PAUSED)"));
+    }
+    if (selectedCountryIndex == -1) return;
 
-    const auto& countries = engine.getCountries();
     std::size_t ci = static_cast<std::size_t>(selectedCountryIndex);
-    if (ci >= countries.size()) return;
+    if (ci >= provinceUI.size()) return;
 
-    const auto& provs = countries[ci].getProvinces();
+    const Country& country = snapshot->country(ci);
+    std::uint64_t version = snapshot->countryVersions[ci];
+    bool full = selectedCountryIndex != shownCountryIndex;
+    if (!full && version == shownCountryVersion) return;
+    shownCountryIndex = selectedCountryIndex;
+    shownCountryVersion = version;
+
+    const auto& provs = country.getProvinces();
     for (std::size_t pi = 0; pi < provs.size(); ++pi) {
         const Province& p = provs[pi]; ProvinceUI& pui = provinceUI[ci][pi];
+        std::uint32_t provinceVersion = country.getProvinceVersion(static_cast<int>(pi));
+        if (!full && provinceVersion == pui.shownVersion && !pui.highlighted) continue;
+        pui.shownVersion = provinceVersion;
+        pui.highlighted = false;
+
         for (auto& icon : pui.resourceIcons) {
             int value = 0;
             switch (icon.kind) {
@@ -335,29 +379,37 @@ void Interface::updateUI() {
                 case StatKind::Mil:      value = p.getMil();       break; case StatKind::Infra:    value = p.getInfra();     break;
                 case StatKind::Dockyard: value = p.getDockyards(); break; case StatKind::Airfield: value = p.getAirfields(); break;
             }
+            sf::Color color = icon.color;
             if (icon.lastValue != -1) {
-                if (value > icon.lastValue) icon.value.setFillColor(sf::Color::Green);
-                else if (value < icon.lastValue) icon.value.setFillColor(sf::Color::Red);
-                else icon.value.setFillColor(sf::Color::White);
+                if (value > icon.lastValue) color = sf::Color::Green;
+                else if (value < icon.lastValue) color = sf::Color::Red;
+                else color = sf::Color::White;
             }
-            icon.lastValue = value; icon.value.setString(std::to_string(value));
+            if (color != sf::Color::White) pui.highlighted = true;
+            if (value == icon.lastValue && color == icon.color) continue;
+
+            icon.color = color;
+            if (value != icon.lastValue) icon.value = std::to_string(value);
+            icon.lastValue = value;
+            provinceBatchDirty = true;
         }
     }
-    const auto& stock = countries[ci].getResourceStockpile();
-    if (countries[ci].getName() == "Romania") {
+
+    const auto& stock = country.getResourceStockpile();
+    if (country.getName() == "Romania") {
         roFuelText.setString(std::to_string(stock.getFuel())); roManpowerText.setString(std::to_string(stock.getManpower()));
-    } else if (countries[ci].getName() == "Hungary") {
+    } else if (country.getName() == "Hungary") {
         huFuelText.setString(std::to_string(stock.getFuel())); huManpowerText.setString(std::to_string(stock.getManpower()));
     }
 
     std::string alertMsg = "";
-    if (countries[ci].getFocusTree().getActiveFocusIndex() == -1) {
+    if (country.getFocusTree().getActiveFocusIndex() == -1) {
         alertMsg += "[!] NO NATIONAL FOCUS SELECTED\n";
     }
-    if (countries[ci].getConstructionQueue().isEmpty()) {
+    if (country.getConstructionQueue().isEmpty()) {
         alertMsg += "[!] NO ACTIVE CONSTRUCTIONS\n";
     }
-    int freeMils = countries[ci].getFreeMilFactories();
+    int freeMils = country.getFreeMilFactories();
     if (freeMils > 0) {
         alertMsg += "[!] FREE MILITARY FACTORIES: " + std::to_string(freeMils) + "\n";
     }
@@ -409,10 +461,9 @@ void Interface::handleEvents() {
             sf::Vector2f mousePos(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
 
             if (showFocusTree && selectedCountryIndex != -1) {
-                Country& currentCountry = engine.getMutableCountries()[selectedCountryIndex];
                 for (int i = 0; i < 4; ++i) {
                     if (focusIconSprites[i].getGlobalBounds().contains(mousePos)) {
-                        if (currentCountry.startFocus(i)) std::cout << "Focus " << i << " started!\n";
+                        simulation.post(EngineCommand::startFocus(selectedCountryIndex, i));
                     }
                 }
             }
@@ -420,7 +471,7 @@ void Interface::handleEvents() {
                 std::size_t ci = static_cast<std::size_t>(selectedCountryIndex);
                 float offsetX = 0.f;
                 float panelWidth = window.getSize().x / 3.0f;
-                if (engine.getCountries()[ci].getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
+                if (snapshot->country(ci).getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
 
                 for (int i = 0; i < 5; ++i) {
                     float originalY = 100.f + i * (64.f + 20.f);
@@ -432,7 +483,7 @@ void Interface::handleEvents() {
 
                 if (selectedBuildingType != -1) {
                     bool clickOnMap = false;
-                    if (engine.getCountries()[ci].getName() == "Hungary") {
+                    if (snapshot->country(ci).getName() == "Hungary") {
                         if (mousePos.x < offsetX) clickOnMap = true;
                     } else {
                         if (mousePos.x > panelWidth) clickOnMap = true;
@@ -442,7 +493,7 @@ void Interface::handleEvents() {
                          for (const auto& zone : clickZones) {
                              if (zone.countryIndex == selectedCountryIndex && zone.bounds.contains(mousePos)) {
                                  // --- MOVED DEFINITION HERE FOR VARIABLE SCOPE ---
-                                 Country& currentCountry = engine.getMutableCountries()[selectedCountryIndex];
+                                 const Country& currentCountry = snapshot->country(ci);
                                  const auto& provs = currentCountry.getProvinces();
                                  const std::string& cName = currentCountry.getName();
                                  for(int pi=0; pi < (int)provs.size(); ++pi) {
@@ -456,11 +507,7 @@ void Interface::handleEvents() {
                                          else if(selectedBuildingType == 3) type = BuildingType::Dockyard;
                                          else type = BuildingType::Airfield;
 
-                                         try {
-                                             currentCountry.addConstruction(type, pi, 1);
-                                         } catch(const std::exception& e) {
-                                             std::cerr << e.what() << "\n";
-                                         }
+                                         simulation.post(EngineCommand::addConstruction(selectedCountryIndex, type, pi, 1));
                                          break;
                                      }
                                  }
@@ -470,7 +517,7 @@ void Interface::handleEvents() {
                 }
             }
             else if (showProduction && selectedCountryIndex != -1) {
-                Country& currentCountry = engine.getMutableCountries()[selectedCountryIndex];
+                const Country& currentCountry = snapshot->country(static_cast<std::size_t>(selectedCountryIndex));
                 float offsetX = 0.f;
                 float panelWidth = window.getSize().x / 3.0f;
                 if (currentCountry.getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
@@ -481,10 +528,10 @@ void Interface::handleEvents() {
                     sf::FloatRect minusBounds(offsetX + 180.f, currentY, 24.f, 24.f);
                     sf::FloatRect plusBounds(offsetX + 240.f, currentY, 24.f, 24.f);
                     if (minusBounds.contains(mousePos)) {
-                        currentCountry.modifyLineFactories(i, -1);
+                        simulation.post(EngineCommand::modifyLineFactories(selectedCountryIndex, i, -1));
                     }
                     else if (plusBounds.contains(mousePos)) {
-                        currentCountry.modifyLineFactories(i, +1);
+                        simulation.post(EngineCommand::modifyLineFactories(selectedCountryIndex, i, +1));
                     }
                     currentY += 80.f;
                 }
@@ -495,12 +542,8 @@ void Interface::handleEvents() {
                 for(int i=0; i<4; ++i) {
                     sf::FloatRect addBounds(startX + i * (iconSize + 10.f), bottomY, iconSize, iconSize);
                     if (addBounds.contains(mousePos)) {
-                        EquipmentType type;
-                        if(i==0) type = EquipmentType::Gun;
-                        else if(i==1) type = EquipmentType::Artillery;
-                        else if(i==2) type = EquipmentType::AntiAir;
-                        else type = EquipmentType::CAS;
-                        currentCountry.addProductionLine(type);
+                        EquipmentType type = EQUIPMENT_CATALOG[static_cast<std::size_t>(i)].type;
+                        simulation.post(EngineCommand::addProductionLine(selectedCountryIndex, type));
                     }
                 }
             }
@@ -508,7 +551,7 @@ void Interface::handleEvents() {
                 for (const auto& zone : clickZones) {
                     if (zone.bounds.contains(mousePos)) {
                         selectedCountryIndex = zone.countryIndex;
-                        infoText.setString("Selected: " + engine.getCountries()[selectedCountryIndex].getName());
+                        infoText.setString("Selected: " + snapshot->country(static_cast<std::size_t>(selectedCountryIndex)).getName());
                         break;
                     }
                 }
@@ -538,7 +581,7 @@ void Interface::render() {
 
     if (showFocusTree && selectedCountryIndex != -1) {
         window.draw(focusBgSprite);
-        const FocusTree& tree = engine.getCountries()[selectedCountryIndex].getFocusTree();
+        const FocusTree& tree = snapshot->country(static_cast<std::size_t>(selectedCountryIndex)).getFocusTree();
         int activeIndex = tree.getActiveFocusIndex();
         for (int i = 0; i < 4; ++i) {
             sf::Sprite& s = focusIconSprites[i];
@@ -555,14 +598,10 @@ void Interface::render() {
         std::size_t ci = static_cast<std::size_t>(selectedCountryIndex);
         float offsetX = 0.f;
         float panelWidth = window.getSize().x / 3.0f;
-        if (engine.getCountries()[ci].getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
+        if (snapshot->country(ci).getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
 
         window.draw(mapSprite);
-        if (ci < provinceUI.size()) {
-             for (auto& pui : provinceUI[ci]) {
-                for (auto& icon : pui.resourceIcons) { window.draw(icon.icon); window.draw(icon.value); }
-            }
-        }
+        drawProvinceIcons(ci);
 
         constructionPanel.setPosition(offsetX, 0.f);
         window.draw(constructionPanel);
@@ -586,7 +625,7 @@ void Interface::render() {
         queueTitleText.setPosition(offsetX + 20.f, 600.f);
         window.draw(queueTitleText);
 
-        const auto& queue = engine.getCountries()[ci].getConstructionQueue();
+        const auto& queue = snapshot->country(ci).getConstructionQueue();
         float qY = 640.f;
         int count = 1;
         for (const auto& item : queue) {
@@ -601,8 +640,8 @@ void Interface::render() {
             }
             int pIdx = item.getProvinceIndex();
             std::string pName = "Unknown";
-            if (pIdx >= 0 && pIdx < (int)engine.getCountries()[ci].getProvinces().size()) {
-                pName = engine.getCountries()[ci].getProvinces()[pIdx].getName();
+            if (pIdx >= 0 && pIdx < (int)snapshot->country(ci).getProvinces().size()) {
+                pName = snapshot->country(ci).getProvinces()[pIdx].getName();
             }
             std::string line = std::to_string(count) + ". " + bName + " in " + pName + " (" + std::to_string((int)item.getRemainingBP()) + " BP left)";
             sf::Text t; t.setFont(font); t.setString(line); t.setCharacterSize(18); t.setPosition(offsetX + 20.f, qY); t.setFillColor(sf::Color::White);
@@ -616,14 +655,10 @@ void Interface::render() {
         std::size_t ci = static_cast<std::size_t>(selectedCountryIndex);
         float offsetX = 0.f;
         float panelWidth = window.getSize().x / 3.0f;
-        if (engine.getCountries()[ci].getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
+        if (snapshot->country(ci).getName() == "Hungary") offsetX = window.getSize().x - panelWidth;
 
         window.draw(mapSprite);
-        if (ci < provinceUI.size()) {
-             for (auto& pui : provinceUI[ci]) {
-                for (auto& icon : pui.resourceIcons) { window.draw(icon.icon); window.draw(icon.value); }
-            }
-        }
+        drawProvinceIcons(ci);
 
         constructionPanel.setPosition(offsetX, 0.f);
         window.draw(constructionPanel);
@@ -631,22 +666,19 @@ void Interface::render() {
         prodTitleText.setPosition(offsetX + 20.f, 20.f);
         window.draw(prodTitleText);
 
-        const auto& lines = engine.getCountries()[ci].getProductionLines();
+        const auto& lines = snapshot->country(ci).getProductionLines();
         float currentY = 100.f;
 
-        const Country& currentCountry = engine.getCountries()[ci];
+        const Country& currentCountry = snapshot->country(ci);
 
         for (const auto& line : lines) {
             sf::Sprite s;
             switch(line.getType()) {
-                case EquipmentType::Gun: s.setTexture(gunTex); break;
-                case EquipmentType::Artillery: s.setTexture(artTex); break;
-                case EquipmentType::AntiAir: s.setTexture(aaTex); break;
-                case EquipmentType::CAS: s.setTexture(casTex); break;
+                case EquipmentType::Gun: setAtlasSprite(s, AtlasIcon::Gun, 64.f); break;
+                case EquipmentType::Artillery: setAtlasSprite(s, AtlasIcon::Artillery, 64.f); break;
+                case EquipmentType::AntiAir: setAtlasSprite(s, AtlasIcon::AntiAir, 64.f); break;
+                case EquipmentType::CAS: setAtlasSprite(s, AtlasIcon::CAS, 64.f); break;
             }
-            float sx = 64.f / s.getTexture()->getSize().x;
-            float sy = 64.f / s.getTexture()->getSize().y;
-            s.setScale(sx, sy);
             s.setPosition(offsetX + 20.f, currentY);
             window.draw(s);
 
@@ -655,18 +687,13 @@ void Interface::render() {
             nameT.setCharacterSize(18);
             nameT.setFillColor(sf::Color::White);
             nameT.setPosition(offsetX + 100.f, currentY);
-            switch(line.getType()) {
-                case EquipmentType::Gun: nameT.setString("Infantry Eq."); break;
-                case EquipmentType::Artillery: nameT.setString("Artillery"); break;
-                case EquipmentType::AntiAir: nameT.setString("Anti-Air"); break;
-                case EquipmentType::CAS: nameT.setString("CAS"); break;
-            }
+            nameT.setString(std::string(equipmentInfo(line.getType()).displayName));
             window.draw(nameT);
 
-            sf::Sprite minusS(minusTex);
-            sf::Sprite plusS(plusTex);
-            minusS.setScale(24.f/minusTex.getSize().x, 24.f/minusTex.getSize().y);
-            plusS.setScale(24.f/plusTex.getSize().x, 24.f/plusTex.getSize().y);
+            sf::Sprite minusS;
+            sf::Sprite plusS;
+            setAtlasSprite(minusS, AtlasIcon::Minus, 24.f);
+            setAtlasSprite(plusS, AtlasIcon::Plus, 24.f);
 
             minusS.setPosition(offsetX + 180.f, currentY);
             plusS.setPosition(offsetX + 240.f, currentY);
@@ -683,7 +710,7 @@ void Interface::render() {
             window.draw(countT);
 
             long long totalStock = currentCountry.getEquipmentCount(line.getType());
-            long long dailyProd = line.calculateDailyOutput();
+            long long dailyProd = line.calculateDailyOutput(currentCountry.getParams().milOutput);
 
             sf::Text statsT;
             statsT.setFont(font);
@@ -692,7 +719,8 @@ void Interface::render() {
             statsT.setPosition(offsetX + 280.f, currentY + 2.f);
 
             std::string statsStr = "In Stock: " + std::to_string(totalStock) +
-                                   " | +" + std::to_string(dailyProd) + "/day";
+                                   " | +" + std::to_string(dailyProd) + "/day" +
+                                   " | Eff: " + std::to_string(line.getEfficiency() / 10) + "%";
             statsT.setString(statsStr);
             window.draw(statsT);
 
@@ -724,14 +752,10 @@ void Interface::render() {
         window.draw(mapSprite);
         if (selectedCountryIndex != -1) {
             std::size_t ci = static_cast<std::size_t>(selectedCountryIndex);
-            if (ci < provinceUI.size()) {
-                for (auto& pui : provinceUI[ci]) {
-                    for (auto& icon : pui.resourceIcons) { window.draw(icon.icon); window.draw(icon.value); }
-                }
-            }
-            if (engine.getCountries()[ci].getName() == "Romania") {
+            drawProvinceIcons(ci);
+            if (snapshot->country(ci).getName() == "Romania") {
                 window.draw(roFuelSprite); window.draw(roManpowerSprite); window.draw(roFuelText); window.draw(roManpowerText);
-            } else if (engine.getCountries()[ci].getName() == "Hungary") {
+            } else if (snapshot->country(ci).getName() == "Hungary") {
                 window.draw(huFuelSprite); window.draw(huManpowerSprite); window.draw(huFuelText); window.draw(huManpowerText);
             }
             window.draw(alertText);
@@ -742,25 +766,79 @@ void Interface::render() {
     window.display();
 }
 
+/**
+ * @brief Deseneaza iconitele si valorile tuturor provinciilor unei tari.
+ *
+ * Quad-urile iconitelor (din atlas) si glifele valorilor sunt adaugate in doua loturi
+ * (sf::VertexArray), deci numarul de apeluri window.draw este 2 indiferent de numarul provinciilor.
+ * Loturile sunt reconstruite doar cand updateUI a schimbat o valoare sau s-a schimbat tara.
+ *
+ * @param countryIndex Indexul tarii selectate.
+ */
+void Interface::drawProvinceIcons(std::size_t countryIndex) {
+    if (countryIndex >= provinceUI.size()) return;
+    if (provinceBatchDirty || batchCountryIndex != static_cast<int>(countryIndex)) {
+        rebuildProvinceBatch(countryIndex);
+    }
+    window.draw(iconBatch, sf::RenderStates(&atlas.getTexture()));
+    window.draw(glyphBatch, sf::RenderStates(&font.getTexture(PROVINCE_VALUE_SIZE)));
+}
+
+/**
+ * @brief Reface loturile de vertecsi (iconite si glife) pentru provinciile unei tari.
+ * @param countryIndex Indexul tarii selectate.
+ */
+void Interface::rebuildProvinceBatch(std::size_t countryIndex) {
+    iconBatch.clear();
+    glyphBatch.clear();
+    for (const auto& pui : provinceUI[countryIndex]) {
+        for (const auto& icon : pui.resourceIcons) {
+            const sf::IntRect& rect = atlas.getRegion(static_cast<std::size_t>(icon.kind));
+            if (rect.width > 0) {
+                appendQuad(iconBatch,
+                           sf::FloatRect(icon.position.x, icon.position.y,
+                                         rect.width * PROVINCE_ICON_SCALE, rect.height * PROVINCE_ICON_SCALE),
+                           sf::FloatRect(rect), sf::Color::White);
+            }
+            appendText(glyphBatch, font, icon.value, { icon.position.x + 32.f, icon.position.y + 4.f },
+                       PROVINCE_VALUE_SIZE, icon.color);
+        }
+    }
+    batchCountryIndex = static_cast<int>(countryIndex);
+    provinceBatchDirty = false;
+}
+
 /**
  * @brief Ruleaza bucla principala a interfetei.
  *
- * Se proceseaza evenimentele in fiecare cadru. Daca exista o tara selectata, timpul este
- * acumulat pentru a simula trecerea zilelor la un pas fix (secondsPerDay).
- * Apoi se actualizeaza UI-ul si se randeaza cadrul.
+ * Simularea ruleaza pe thread-ul ei (SimulationThread), cu o zi la fiecare DAY_DURATION cat timp
+ * exista o tara selectata. Fiecare cadru preia ultimul snapshot publicat, proceseaza evenimentele
+ * (actiunile jucatorului devin comenzi in coada simularii), actualizeaza UI-ul si randeaza cadrul;
+ * tara selectata este urmarita (SimulationThread::watch), deci doar ea este adusa la zi in snapshot-uri;
+ * un cadru lent nu mai intarzie zilele, iar o zi lenta nu mai blocheaza cadrele.
  */
 void Interface::run() {
-    sf::Clock clock;
-    float accumulator = 0.f;
-    const float secondsPerDay = 1.0f;
+    simulation.start();
     while (window.isOpen()) {
-        handleEvents();
-        if (selectedCountryIndex != -1) {
-            float dt = clock.restart().asSeconds();
-            accumulator += dt;
-            while (accumulator >= secondsPerDay) { engine.simulateOneDay(); accumulator -= secondsPerDay; }
+        PROFILE_SCOPE("ui.frame");
+        snapshot = simulation.snapshot();
+        {
+            PROFILE_SCOPE("ui.handleEvents");
+            handleEvents();
+        }
+        bool running = selectedCountryIndex != -1;
+        if (running != shownRunning) {
+            shownRunning = running;
+            dayTextDirty = true;
+        }
+        simulation.setRunning(running);
+        simulation.watch(selectedCountryIndex);
+        {
+            PROFILE_SCOPE("ui.updateUI");
             updateUI();
-        } else { clock.restart(); }
+        }
+        PROFILE_SCOPE("ui.render");
         render();
     }
+    simulation.stop();
 }
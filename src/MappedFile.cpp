@@ -0,0 +1,72 @@
+#include "../headers/MappedFile.h"
+#include "../headers/GameExceptions.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string &path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw GameException("Nu se poate deschide fisierul " + path);
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throw GameException("Nu se poate citi dimensiunea fisierului " + path);
+    }
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+    if (length == 0) {
+        CloseHandle(file);
+        return;
+    }
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) throw GameException("Nu se poate mapa fisierul " + path);
+    ptr = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!ptr) {
+        CloseHandle(mapping);
+        throw GameException("Nu se poate mapa fisierul " + path);
+    }
+}
+
+void MappedFile::release() noexcept {
+    if (ptr) UnmapViewOfFile(ptr);
+    if (mapping) CloseHandle(mapping);
+}
+#else
+MappedFile::MappedFile(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw GameException("Nu se poate deschide fisierul " + path);
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw GameException("Nu se poate citi dimensiunea fisierului " + path);
+    }
+    length = static_cast<std::size_t>(st.st_size);
+    if (length == 0) {
+        ::close(fd);
+        return;
+    }
+    void *p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) throw GameException("Nu se poate mapa fisierul " + path);
+    ptr = static_cast<const char *>(p);
+}
+
+void MappedFile::release() noexcept {
+    if (ptr) ::munmap(const_cast<char *>(ptr), length);
+}
+#endif
+
+MappedFile::~MappedFile() {
+    release();
+}
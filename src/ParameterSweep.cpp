@@ -0,0 +1,187 @@
+/**
+ * @file ParameterSweep.cpp
+ * @brief Rularea simularii pe o grila de parametri si mai multe seed-uri, in paralel.
+ */
+
+#include "../headers/ParameterSweep.h"
+#include "../headers/GameExceptions.h"
+#include "../headers/ThreadPool.h"
+#include "../headers/WorldGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+namespace {
+    std::vector<std::string> splitList(const std::string &list) {
+        std::vector<std::string> items;
+        std::stringstream ss(list);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            if (item.empty()) throw GameException("Valoare lipsa in lista: " + list);
+            items.push_back(item);
+        }
+        if (items.empty()) throw GameException("Lista de valori goala");
+        return items;
+    }
+
+    std::uint64_t parseSeed(const std::string &text) {
+        try {
+            std::size_t used = 0;
+            unsigned long long v = std::stoull(text, &used, 0);
+            if (used == text.size() && text.front() != '-') return v;
+        } catch (const std::logic_error &) {
+        }
+        throw GameException("Seed invalid: " + text);
+    }
+
+    // true daca scenariul este o lume sintetica fara cheia seed (lumea poate varia cu seed-ul rularii)
+    bool hasFreeWorldSeed(const std::string &scenario) {
+        if (!scenario.starts_with(WorldGenerator::SCENARIO_PREFIX)) return false;
+        std::stringstream ss(scenario.substr(std::string(WorldGenerator::SCENARIO_PREFIX).size()));
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            if (item.starts_with("seed=")) return false;
+        }
+        return true;
+    }
+
+    std::string scenarioForSeed(const std::string &scenario, std::uint64_t seed) {
+        bool bare = scenario == WorldGenerator::SCENARIO_PREFIX || scenario.ends_with(',');
+        return scenario + (bare ? "" : ",") + "seed=" + std::to_string(seed);
+    }
+
+    SweepMetrics collectMetrics(Engine &engine) {
+        SweepMetrics m{};
+        for (const auto &c: engine.getCountries()) {
+            m[0] += c.getResourceStockpile().getFuel();
+            m[1] += c.totalCiv();
+            m[2] += c.totalMil();
+            for (std::size_t t = 0; t < EQUIPMENT_TYPE_COUNT; ++t)
+                m[3 + t] += static_cast<double>(c.getEquipmentCount(static_cast<EquipmentType>(t)));
+        }
+        return m;
+    }
+
+    // `sorted` este nevid si sortat crescator; rangul cel mai apropiat: ceil(p * n)
+    double percentile(const std::vector<double> &sorted, double p) {
+        auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+        return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+    }
+
+    SweepStats summarize(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        double sum = 0;
+        for (double v: values) sum += v;
+        return {sum / static_cast<double>(values.size()), values.front(), percentile(values, 0.10),
+                percentile(values, 0.50), percentile(values, 0.90), values.back()};
+    }
+}
+
+std::string_view ParameterSweep::metricName(std::size_t metric) {
+    static constexpr std::array<std::string_view, 3> BASE{"fuel", "civ", "mil"};
+    return metric < BASE.size() ? BASE[metric] : EQUIPMENT_CATALOG[metric - BASE.size()].shortName;
+}
+
+SweepAxis ParameterSweep::parseAxis(const std::string &arg) {
+    auto eq = arg.find('=');
+    if (eq == std::string::npos || eq == 0) throw GameException("Axa invalida (astept cheie=v1,v2,...): " + arg);
+    return {arg.substr(0, eq), splitList(arg.substr(eq + 1))};
+}
+
+std::vector<std::uint64_t> ParameterSweep::parseSeeds(const std::string &arg) {
+    std::vector<std::uint64_t> seeds;
+    auto dash = arg.find('-', 1);
+    if (arg.find(',') == std::string::npos && dash != std::string::npos) {
+        std::uint64_t first = parseSeed(arg.substr(0, dash));
+        std::uint64_t last = parseSeed(arg.substr(dash + 1));
+        if (last < first || last - first >= 1000000) throw GameException("Interval de seed-uri invalid: " + arg);
+        for (std::uint64_t s = first; s <= last; ++s) seeds.push_back(s);
+        return seeds;
+    }
+    for (const auto &item: splitList(arg)) seeds.push_back(parseSeed(item));
+    return seeds;
+}
+
+/**
+ * @brief Ruleaza toate perechile (punct din grila, seed) si calculeaza statisticile fiecarui punct.
+ *
+ * Parametrii fiecarui punct sunt construiti si validati inainte de pornire. Simularea in sine nu are
+ * intrari aleatoare care sa schimbe metricile, deci seed-ul rularii variaza lumea: pentru un scenariu
+ * sintetic fara cheia seed, fiecare rulare genereaza lumea cu seed-ul ei. Pentru celelalte scenarii toate
+ * seed-urile ar da acelasi rezultat, asa ca este acceptat un singur seed. Rularea k (punctul k / seeds,
+ * seed-ul k % seeds) isi construieste propriul Engine, il avanseaza `days` zile si isi scrie metricile
+ * in slotul k, deci thread-urile nu scriu niciodata aceeasi memorie si nu au nevoie de sincronizare.
+ *
+ * @param config Scenariul, grila, seed-urile, numarul de zile si de thread-uri.
+ * @return Statisticile fiecarui punct, in ordinea lexicografica a grilei (ultima axa variaza cel mai repede).
+ * @throws GameException pentru o configuratie invalida (inclusiv mai multe seed-uri pentru un scenariu
+ *         a carui lume nu depinde de seed) sau daca o rulare esueaza.
+ */
+SweepResult ParameterSweep::run(const SweepConfig &config) {
+    if (config.days < 0) throw GameException("Numarul de zile trebuie sa fie >= 0");
+    if (config.seeds.empty()) throw GameException("Lista de seed-uri este goala");
+    const bool seededWorld = hasFreeWorldSeed(config.scenario);
+    if (!seededWorld && config.seeds.size() > 1) {
+        throw GameException("Seed-urile nu schimba rezultatul pentru scenariul " + config.scenario
+                            + " (doar un scenariu synthetic: fara cheia seed variaza cu seed-ul)");
+    }
+
+    std::size_t gridSize = 1;
+    for (const auto &axis: config.axes) {
+        if (axis.values.empty()) throw GameException("Axa fara valori: " + axis.key);
+        gridSize *= axis.values.size();
+    }
+
+    SweepResult result;
+    result.points.resize(gridSize);
+    std::vector<SimulationParams> grid(gridSize);
+    for (std::size_t g = 0; g < gridSize; ++g) {
+        std::size_t rest = g;
+        result.points[g].values.resize(config.axes.size());
+        for (std::size_t a = config.axes.size(); a-- > 0;) {
+            const auto &axis = config.axes[a];
+            const std::string &value = axis.values[rest % axis.values.size()];
+            rest /= axis.values.size();
+            grid[g].set(axis.key, value);
+            result.points[g].values[a] = value;
+        }
+        grid[g].validate();
+    }
+
+    const std::size_t seedCount = config.seeds.size();
+    const std::size_t runs = gridSize * seedCount;
+    std::vector<SweepMetrics> metrics(runs);
+    const std::function<void(std::size_t)> job = [&](std::size_t k) {
+        std::uint64_t seed = config.seeds[k % seedCount];
+        Engine engine(seededWorld ? scenarioForSeed(config.scenario, seed) : config.scenario, seed,
+                      grid[k / seedCount]);
+        engine.advance(config.days);
+        metrics[k] = collectMetrics(engine);
+    };
+
+    unsigned workers = config.workers == 0 ? std::max(1u, std::thread::hardware_concurrency()) : config.workers;
+    workers = static_cast<unsigned>(std::min<std::size_t>(workers, runs));
+    auto start = std::chrono::steady_clock::now();
+    if (workers <= 1) {
+        for (std::size_t k = 0; k < runs; ++k) job(k);
+    } else {
+        ThreadPool pool(workers - 1);
+        pool.parallelFor(runs, job);
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.runs = runs;
+    result.workers = std::max(1u, workers);
+
+    std::vector<double> column(seedCount);
+    for (std::size_t g = 0; g < gridSize; ++g) {
+        for (std::size_t m = 0; m < SWEEP_METRIC_COUNT; ++m) {
+            for (std::size_t s = 0; s < seedCount; ++s) column[s] = metrics[g * seedCount + s][m];
+            result.points[g].stats[m] = summarize(column);
+        }
+    }
+    return result;
+}
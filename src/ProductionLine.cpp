@@ -1,30 +1,16 @@
 #include "../headers/ProductionLine.h"
-#include <cmath>
 
-ProductionLine::ProductionLine(EquipmentType t, int f, double eff)
-    : type(t), factories(f), efficiency(eff) {
-    switch (type) {
-        case EquipmentType::Gun: unitCost = 0.5;
-            break;
-        case EquipmentType::Artillery: unitCost = 3.5;
-            break;
-        case EquipmentType::AntiAir: unitCost = 4.0;
-            break;
-        case EquipmentType::CAS: unitCost = 12.0;
-            break;
-    }
+ProductionLine::ProductionLine(EquipmentType t, int f, int eff, long long progress)
+    : type(t), factories(f), efficiency(eff), progress(progress) {
 }
 
 EquipmentType ProductionLine::getType() const { return type; }
 int ProductionLine::getFactories() const { return factories; }
-double ProductionLine::getEfficiency() const { return efficiency; }
-double ProductionLine::getUnitCost() const { return unitCost; }
+int ProductionLine::getEfficiency() const { return efficiency; }
+double ProductionLine::getUnitCost() const { return equipmentInfo(type).unitCostMilli / 1000.0; }
+long long ProductionLine::getProgress() const { return progress; }
 
-void ProductionLine::setFactories(int count) {
-    factories = count;
-}
-
-long long ProductionLine::calculateDailyOutput() const {
-    double baseOutput = 1000.0;
-    return static_cast<long long>(std::floor((factories * baseOutput) / unitCost));
+long long ProductionLine::calculateDailyOutput(int milOutput) const {
+    long long dailyMilli = static_cast<long long>(factories) * milOutput * efficiency;
+    return dailyMilli / equipmentInfo(type).unitCostMilli;
 }
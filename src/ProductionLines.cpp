@@ -0,0 +1,86 @@
+#include "../headers/ProductionLines.h"
+
+#include <algorithm>
+
+void ProductionLines::add(EquipmentType type, int factoryCount, int eff, long long carried) {
+    types.push_back(static_cast<std::uint8_t>(type));
+    factories.push_back(factoryCount);
+    efficiency.push_back(eff);
+    progress.push_back(carried);
+}
+
+int ProductionLines::totalFactories() const {
+    int total = 0;
+    for (std::int32_t f: factories) total += f;
+    return total;
+}
+
+/**
+ * @brief Schimba numarul de fabrici al unei linii, aplicand costul de reorganizare.
+ *
+ * Fabricile noi pornesc de la EFFICIENCY_START, deci eficienta liniei devine media ponderata dintre
+ * fabricile vechi si cele noi. Cand se iau fabrici linia pierde RETOOLING_PENALTY, dar nu coboara
+ * sub EFFICIENCY_START din cauza asta.
+ *
+ * @param index Indexul liniei.
+ * @param count Numarul nou de fabrici (>= 0).
+ */
+void ProductionLines::setFactories(std::size_t index, int count) {
+    int old = factories[index];
+    int eff = efficiency[index];
+    if (count > old) {
+        long long weighted = static_cast<long long>(eff) * old +
+                             static_cast<long long>(ProductionLine::EFFICIENCY_START) * (count - old);
+        efficiency[index] = static_cast<std::int32_t>(weighted / count);
+    } else if (count < old) {
+        efficiency[index] = std::max(std::min(eff, ProductionLine::EFFICIENCY_START),
+                                     eff - ProductionLine::RETOOLING_PENALTY);
+    }
+    factories[index] = count;
+}
+
+/**
+ * @brief Avanseaza toate liniile cu `days` zile si aduna unitatile terminate in `produced`.
+ *
+ * In fiecare zi o linie adauga factories * milOutput * efficiency miimi de IC la progres, apoi
+ * eficienta creste cu EFFICIENCY_GROWTH (pana la plafon). Suma pe mai multe zile este calculata
+ * in forma inchisa (rampa aritmetica + zile la plafon), in aritmetica intreaga, deci produce(n)
+ * da exact acelasi rezultat ca n apeluri produce(1).
+ *
+ * @param days Numarul de zile (<= 0 nu face nimic).
+ * @param produced Unitatile produse, indexate dupa EquipmentType.
+ * @param milOutput IC produse pe zi de o fabrica la eficienta maxima.
+ */
+void ProductionLines::produce(int days, EquipmentStockpile::Counts &produced, int milOutput) {
+    if (days <= 0) return;
+    constexpr long long cap = ProductionLine::EFFICIENCY_CAP;
+    constexpr long long growth = ProductionLine::EFFICIENCY_GROWTH;
+
+    const std::size_t n = size();
+    for (std::size_t i = 0; i < n; ++i) {
+        const long long cost = EQUIPMENT_CATALOG[types[i]].unitCostMilli;
+        const long long base = static_cast<long long>(factories[i]) * milOutput;
+        const long long e0 = efficiency[i];
+
+        // zilele in care eficienta este inca sub plafon: e0, e0 + growth, ...
+        long long ramp = e0 >= cap ? 0 : std::min<long long>(days, (cap - e0 + growth - 1) / growth);
+        long long rampSum = ramp * e0 + growth * ramp * (ramp - 1) / 2;
+
+        long long p = progress[i] + base * rampSum;
+        long long units = p / cost;
+        p %= cost;
+
+        long long flat = days - ramp;
+        if (flat > 0 && base > 0) {
+            long long rate = base * cap;
+            units += rate / cost * flat;
+            p += rate % cost * flat;
+            units += p / cost;
+            p %= cost;
+        }
+
+        produced[types[i]] += units;
+        progress[i] = p;
+        efficiency[i] = static_cast<std::int32_t>(std::min(cap, e0 + growth * days));
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * @file Profiler.cpp
+ * @brief Agregarea timpilor masurati cu PROFILE_SCOPE: tabele per thread, histograme si raport.
+ *
+ * Fiecare thread primeste la prima masurare o tabela proprie, inregistrata intr-o lista globala
+ * (singurul loc protejat de mutex). Valorile sunt atomice, dar fiecare are un singur scriitor,
+ * deci actualizarea este un load + store relaxat, fara instructiuni de tip read-modify-write.
+ */
+
+#include "../headers/Profiler.h"
+#include <algorithm>
+#include <bit>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace {
+    using Counter = std::atomic<std::uint64_t>;
+
+    struct PhaseCounters {
+        Counter calls{0};
+        Counter totalNs{0};
+        Counter maxNs{0};
+        std::array<Counter, Profiler::HISTOGRAM_BUCKETS> histogram{};
+    };
+
+    struct ThreadTable {
+        std::array<PhaseCounters, Profiler::MAX_PHASES> phases;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::string> names;
+        // tabelele raman in registru si dupa terminarea thread-ului, ca valorile lor sa intre in raport
+        std::vector<std::shared_ptr<ThreadTable> > tables;
+    };
+
+    Registry &registry() {
+        static Registry r;
+        return r;
+    }
+
+    ThreadTable &localTable() {
+        thread_local std::shared_ptr<ThreadTable> table = [] {
+            auto t = std::make_shared<ThreadTable>();
+            Registry &r = registry();
+            std::lock_guard lock(r.mutex);
+            r.tables.push_back(t);
+            return t;
+        }();
+        return *table;
+    }
+
+    void bump(Counter &c, std::uint64_t v) {
+        c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+
+    std::size_t bucketOf(std::uint64_t ns) {
+        if (ns < 4) return static_cast<std::size_t>(ns);
+        auto exponent = static_cast<std::size_t>(std::bit_width(ns)) - 1;
+        auto sub = static_cast<std::size_t>((ns >> (exponent - 2)) & 3);
+        return (exponent - 1) * 4 + sub;
+    }
+
+    // mijlocul intervalului de valori acoperit de o galeata
+    std::uint64_t bucketValue(std::size_t bucket) {
+        if (bucket < 4) return bucket;
+        std::size_t exponent = bucket / 4 + 1;
+        std::uint64_t sub = bucket % 4;
+        std::uint64_t low = (4 + sub) << (exponent - 2);
+        std::uint64_t width = std::uint64_t{1} << (exponent - 2);
+        return low + width / 2;
+    }
+
+    std::uint64_t percentile(const std::array<std::uint64_t, Profiler::HISTOGRAM_BUCKETS> &hist,
+                             std::uint64_t calls, double q) {
+        auto rank = static_cast<std::uint64_t>(q * static_cast<double>(calls - 1));
+        std::uint64_t seen = 0;
+        for (std::size_t b = 0; b < hist.size(); ++b) {
+            seen += hist[b];
+            if (seen > rank) return bucketValue(b);
+        }
+        return 0;
+    }
+}
+
+int Profiler::registerPhase(const char *name) {
+    Registry &r = registry();
+    std::lock_guard lock(r.mutex);
+    auto it = std::find(r.names.begin(), r.names.end(), name);
+    if (it != r.names.end()) return static_cast<int>(it - r.names.begin());
+    // fazele in plus sunt cumulate in ultima intrare, ca masurarea sa nu poata esua
+    if (r.names.size() == MAX_PHASES) return static_cast<int>(MAX_PHASES) - 1;
+    r.names.emplace_back(name);
+    return static_cast<int>(r.names.size()) - 1;
+}
+
+void Profiler::record(int phase, std::uint64_t ns) {
+    PhaseCounters &c = localTable().phases[static_cast<std::size_t>(phase)];
+    bump(c.calls, 1);
+    bump(c.totalNs, ns);
+    if (ns > c.maxNs.load(std::memory_order_relaxed)) c.maxNs.store(ns, std::memory_order_relaxed);
+    bump(c.histogram[bucketOf(ns)], 1);
+}
+
+std::vector<Profiler::PhaseReport> Profiler::report() {
+    Registry &r = registry();
+    std::lock_guard lock(r.mutex);
+    std::vector<PhaseReport> result;
+    for (std::size_t p = 0; p < r.names.size(); ++p) {
+        PhaseReport rep{r.names[p], 0, 0, 0, 0, 0, 0, 0};
+        std::array<std::uint64_t, HISTOGRAM_BUCKETS> hist{};
+        for (const auto &table: r.tables) {
+            const PhaseCounters &c = table->phases[p];
+            rep.calls += c.calls.load(std::memory_order_relaxed);
+            rep.totalNs += c.totalNs.load(std::memory_order_relaxed);
+            rep.maxNs = std::max(rep.maxNs, c.maxNs.load(std::memory_order_relaxed));
+            for (std::size_t b = 0; b < HISTOGRAM_BUCKETS; ++b) hist[b] += c.histogram[b].load(std::memory_order_relaxed);
+        }
+        if (rep.calls > 0) {
+            rep.meanNs = static_cast<double>(rep.totalNs) / static_cast<double>(rep.calls);
+            rep.p50Ns = percentile(hist, rep.calls, 0.50);
+            rep.p90Ns = percentile(hist, rep.calls, 0.90);
+            rep.p99Ns = percentile(hist, rep.calls, 0.99);
+        }
+        result.push_back(std::move(rep));
+    }
+    return result;
+}
+
+void Profiler::reset() {
+    Registry &r = registry();
+    std::lock_guard lock(r.mutex);
+    for (const auto &table: r.tables) {
+        for (auto &c: table->phases) {
+            c.calls.store(0, std::memory_order_relaxed);
+            c.totalNs.store(0, std::memory_order_relaxed);
+            c.maxNs.store(0, std::memory_order_relaxed);
+            for (auto &b: c.histogram) b.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Profiler::dump(std::ostream &os) {
+    auto phases = report();
+    os << "=== PROFILE ===\n";
+    os << std::left << std::setw(28) << "phase" << std::right
+            << std::setw(12) << "calls" << std::setw(14) << "total_ms" << std::setw(12) << "mean_ns"
+            << std::setw(12) << "p50_ns" << std::setw(12) << "p90_ns" << std::setw(12) << "p99_ns"
+            << std::setw(12) << "max_ns" << "\n";
+    for (const auto &p: phases) {
+        os << std::left << std::setw(28) << p.name << std::right
+                << std::setw(12) << p.calls
+                << std::setw(14) << std::fixed << std::setprecision(3) << static_cast<double>(p.totalNs) / 1e6
+                << std::setw(12) << std::setprecision(0) << p.meanNs
+                << std::setw(12) << p.p50Ns << std::setw(12) << p.p90Ns << std::setw(12) << p.p99Ns
+                << std::setw(12) << p.maxNs << "\n";
+    }
+    os.unsetf(std::ios::floatfield);
+    os << std::setprecision(6);
+}
@@ -4,25 +4,29 @@
  *
  * Model:
  *  - date brute: populatie, fabrici, infrastructura, resurse numerice (steel/tungsten/aluminum/chromium/oil)
- *  - vectorul `resources` contine obiecte polymorfice (Material/DailyOutput/ConstructionResource etc.)
- *    create prin ResourceFactory, folosite pentru aplicarea efectelor zilnice asupra unui ResourceStockpile.
+ *  - tabela `effects` contine inregistrari compacte ResourceEffect (Material/DailyOutput/Construction),
+ *    fara alocari si fara apeluri virtuale; fuel-ul zilnic este calculat de Country din totalul de petrol.
+ *  - obiectele polymorfice (AbstractResource) sunt create prin ResourceFactory doar la cerere, pentru afisare.
  *
  * Notite:
- *  - initResources() reconstruieste lista `resources` din valorile numerice curente.
- *  - metodele add* modifica un atribut si apoi refac `resources` pentru consistenta.
+ *  - initResources() reconstruieste tabela `effects` din valorile numerice curente (fara alocari).
+ *  - metodele add* modifica un atribut si apoi refac `effects` pentru consistenta.
  */
 
 #include "../headers/Province.h"
+#include "../headers/BinaryIO.h"
 #include "../headers/ResourceFactory.h"
+#include "../headers/SimulationParams.h"
 #include "../headers/Utils.h"
 #include <sstream>
 #include <algorithm>
+#include <iterator>
 
 /**
  * @brief Constructor: initializeaza o provincie cu valori brute pentru populatie, cladiri si resurse.
  *
  * Valori negative sunt clamp-uite la 0, iar infrastructura este limitata in [0, 10].
- * Dupa validare, initResources() construieste lista de resurse (objects) pe baza valorilor numerice.
+ * Dupa validare, initResources() construieste tabela de efecte pe baza valorilor numerice.
  *
  * @param name Numele provinciei.
  * @param pop Populatia (valori < 0 devin 0).
@@ -73,8 +77,7 @@ Province::Province(std::string name,
 /**
  * @brief Copy-constructor.
  *
- * Face deep-copy pentru vectorul de `resources` (clone pe fiecare resursa),
- * astfel incat provinciile sa nu partajeze aceleasi obiecte polymorfice.
+ * Tabela de efecte este un array de valori, deci copierea nu mai face alocari sau clone().
  *
  * @param other Provincia sursa.
  */
@@ -94,12 +97,9 @@ Province::Province(const Province &other)
       tungsten(other.tungsten),
       aluminum(other.aluminum),
       chromium(other.chromium),
-      oil(other.oil) {
-    resources.clear();
-    resources.reserve(other.resources.size());
-    for (const auto &resPtr: other.resources) {
-        resources.push_back(resPtr->clone());
-    }
+      oil(other.oil),
+      effects(other.effects),
+      effectCount(other.effectCount) {
 }
 
 /**
@@ -116,43 +116,76 @@ Province &Province::operator=(Province other) {
 }
 
 /**
- * @brief Reconstruieste lista de resurse (objects) pe baza valorilor numerice curente.
+ * @brief Reconstruieste tabela de efecte pe baza valorilor numerice curente.
  *
- * Curata `resources` si adauga:
+ * Rescrie `effects` (fara alocari) si adauga, in aceasta ordine:
  *  - materiale (Steel/Aluminum/Tungsten/Chromium) daca valorile sunt > 0
- *  - productie zilnica (Oil) daca oil > 0 (cu output zilnic fix: 5)
+ *  - productie zilnica (Oil) daca oil > 0 (fuel-ul este calculat de Country din totalul de petrol,
+ *    cu SimulationParams::oilToFuel)
  *  - resurse de constructie pentru civ/mil/infra/dockyards/airfields daca sunt > 0
  *
  * Aceasta metoda este chemata dupa orice modificare a valorilor relevante (addCiv/addMil/etc.)
- * pentru a mentine consistenta intre campurile numerice si reprezentarea polymorfica.
+ * pentru a mentine consistenta intre campurile numerice si tabela de efecte.
  */
 void Province::initResources() {
-    resources.clear();
+    effectCount = 0;
+    auto push = [this](ResourceEffectKind kind, const char *resName, int amount, ConstructionType building) {
+        effects[effectCount++] = ResourceEffect{kind, building, resName, amount};
+    };
 
-    if (steel > 0)
-        resources.push_back(ResourceFactory::createMaterial("Steel", steel));
-    if (aluminum > 0)
-        resources.push_back(ResourceFactory::createMaterial("Aluminum", aluminum));
-    if (tungsten > 0)
-        resources.push_back(ResourceFactory::createMaterial("Tungsten", tungsten));
-    if (chromium > 0)
-        resources.push_back(ResourceFactory::createMaterial("Chromium", chromium));
+    if (steel > 0) push(ResourceEffectKind::Material, "Steel", steel, ConstructionType::Civ);
+    if (aluminum > 0) push(ResourceEffectKind::Material, "Aluminum", aluminum, ConstructionType::Civ);
+    if (tungsten > 0) push(ResourceEffectKind::Material, "Tungsten", tungsten, ConstructionType::Civ);
+    if (chromium > 0) push(ResourceEffectKind::Material, "Chromium", chromium, ConstructionType::Civ);
 
-    if (oil > 0)
-        resources.push_back(ResourceFactory::createDailyOutput("Oil", oil, 5));
+    if (oil > 0) push(ResourceEffectKind::DailyOutput, "Oil", oil, ConstructionType::Civ);
 
     if (civFactories > 0)
-        resources.push_back(ResourceFactory::createConstruction("Civ factories", civFactories, ConstructionType::Civ));
+        push(ResourceEffectKind::Construction, "Civ factories", civFactories, ConstructionType::Civ);
     if (milFactories > 0)
-        resources.push_back(ResourceFactory::createConstruction("Mil factories", milFactories, ConstructionType::Mil));
+        push(ResourceEffectKind::Construction, "Mil factories", milFactories, ConstructionType::Mil);
     if (infrastructure > 0)
-        resources.push_back(
-            ResourceFactory::createConstruction("Infrastructure", infrastructure, ConstructionType::Infra));
+        push(ResourceEffectKind::Construction, "Infrastructure", infrastructure, ConstructionType::Infra);
 
     if (dockyards > 0)
-        resources.push_back(ResourceFactory::createConstruction("Dockyards", dockyards, ConstructionType::Dockyard));
+        push(ResourceEffectKind::Construction, "Dockyards", dockyards, ConstructionType::Dockyard);
     if (airfields > 0)
-        resources.push_back(ResourceFactory::createConstruction("Airfields", airfields, ConstructionType::Airfield));
+        push(ResourceEffectKind::Construction, "Airfields", airfields, ConstructionType::Airfield);
+}
+
+/**
+ * @brief Ca resourceView(int), cu raportul implicit oil -> fuel din SimulationParams.
+ * @return Vector de resurse polymorfice, in ordinea din tabela de efecte.
+ */
+std::vector<std::unique_ptr<AbstractResource> > Province::resourceView() const {
+    return resourceView(SimulationParams{}.oilToFuel);
+}
+
+/**
+ * @brief Construieste la cerere reprezentarea polymorfica a resurselor (pentru afisare / inspectie).
+ *
+ * Obiectele sunt create prin ResourceFactory din tabela de efecte; nu sunt folosite in simularea zilnica.
+ *
+ * @param oilToFuel Fuel produs pe zi de o unitate de petrol (parametrii tarii care detine provincia).
+ * @return Vector de resurse polymorfice, in ordinea din tabela de efecte.
+ */
+std::vector<std::unique_ptr<AbstractResource> > Province::resourceView(int oilToFuel) const {
+    std::vector<std::unique_ptr<AbstractResource> > view;
+    view.reserve(effectCount);
+    for (const ResourceEffect *e = effectsBegin(); e != effectsEnd(); ++e) {
+        switch (e->kind) {
+            case ResourceEffectKind::Material:
+                view.push_back(ResourceFactory::createMaterial(e->name, e->amount));
+                break;
+            case ResourceEffectKind::DailyOutput:
+                view.push_back(ResourceFactory::createDailyOutput(e->name, e->amount, oilToFuel));
+                break;
+            case ResourceEffectKind::Construction:
+                view.push_back(ResourceFactory::createConstruction(e->name, e->amount, e->building));
+                break;
+        }
+    }
+    return view;
 }
 
 /**
@@ -201,47 +234,76 @@ void Province::addAirfield(int x) {
 }
 
 /**
- * @brief Aplica efectele zilnice ale resurselor provinciei asupra stockpile-ului.
- *
- * Itereaza peste `resources` si apeleaza applyDailyEffect() pe fiecare resursa polymorfica.
- *
- * @param stockpile Stockpile-ul global al tarii care este modificat de efectele provinciei.
+ * @brief Adauga (sau scade) army research facilities si mentine valoarea in [0, +inf).
+ * @param x Diferenta aplicata numarului de army research facilities (poate fi negativa).
  */
-void Province::applyResourceEffects(ResourceStockpile &stockpile) const {
-    for (const auto &res: resources) {
-        res->applyDailyEffect(stockpile);
-    }
+void Province::addArmyRF(int x) {
+    armyRF = std::max(0, armyRF + x);
+    initResources();
+}
+
+/**
+ * @brief Adauga (sau scade) naval research facilities si mentine valoarea in [0, +inf).
+ * @param x Diferenta aplicata numarului de naval research facilities (poate fi negativa).
+ */
+void Province::addNavalRF(int x) {
+    navalRF = std::max(0, navalRF + x);
+    initResources();
+}
+
+/**
+ * @brief Adauga (sau scade) aerial research facilities si mentine valoarea in [0, +inf).
+ * @param x Diferenta aplicata numarului de aerial research facilities (poate fi negativa).
+ */
+void Province::addAerialRF(int x) {
+    aerialRF = std::max(0, aerialRF + x);
+    initResources();
+}
+
+/**
+ * @brief Adauga (sau scade) nuclear research facilities si mentine valoarea in [0, +inf).
+ * @param x Diferenta aplicata numarului de nuclear research facilities (poate fi negativa).
+ */
+void Province::addNuclearRF(int x) {
+    nuclearRF = std::max(0, nuclearRF + x);
+    initResources();
 }
 
 /**
  * @brief Calculeaza numarul total de sloturi de constructie (din resurse), excluzand infrastructura.
  *
- * Interpreteaza doar resursele de tip ConstructionResource si insumeaza amount pentru toate
- * tipurile diferite de Infra (Infra este exclusa explicit).
+ * Insumeaza amount pentru efectele de tip Construction, cu exceptia celor de tip Infra.
  *
- * @return Totalul sloturilor de constructie non-infra provenite din `resources`.
+ * @return Totalul sloturilor de constructie non-infra provenite din tabela de efecte.
  */
 int Province::totalConstructionSlotsFromResources() const {
     int total = 0;
-    for (const auto &res: resources) {
-        if (auto *cr = dynamic_cast<const ConstructionResource *>(res.get())) {
-            if (cr->getType() != ConstructionType::Infra) {
-                total += cr->getAmount();
-            }
+    for (const ResourceEffect *e = effectsBegin(); e != effectsEnd(); ++e) {
+        if (e->kind == ResourceEffectKind::Construction && e->building != ConstructionType::Infra) {
+            total += e->amount;
         }
     }
     return total;
 }
 
+/**
+ * @brief Ca toString(int), cu raportul implicit oil -> fuel din SimulationParams.
+ * @return String descriptiv pentru debug/logging.
+ */
+std::string Province::toString() const {
+    return toString(SimulationParams{}.oilToFuel);
+}
+
 /**
  * @brief Construieste o reprezentare text detaliata a provinciei.
  *
  * Include datele principale (populatie, cladiri, resurse numerice) + lista de obiecte resursa
- * (RES_OBJS) prin apelul virtual print().
+ * (RES_OBJS), construita la cerere prin resourceView() si afisata prin apelul virtual print().
  *
+ * @param oilToFuel Fuel produs pe zi de o unitate de petrol, afisat pentru resursa Oil.
  * @return String descriptiv pentru debug/logging.
  */
-std::string Province::toString() const {
+std::string Province::toString(int oilToFuel) const {
     std::ostringstream ss;
     ss << "Province(" << getName() << ") pop=" << getPopulation()
             << ", CIV=" << getCiv()
@@ -260,6 +322,7 @@ std::string Province::toString() const {
             << ",Nuclear=" << getNuclearRF() << "]";
 
     ss << ", RES_OBJS={";
+    auto resources = resourceView(oilToFuel);
     for (std::size_t i = 0; i < resources.size(); ++i) {
         resources[i]->print(ss);
         if (i + 1 < resources.size()) ss << "; ";
@@ -278,3 +341,47 @@ std::string Province::toString() const {
 std::ostream &operator<<(std::ostream &os, const Province &p) {
     return os << p.toString();
 }
+
+/**
+ * @brief Scrie provincia in formatul binar al snapshot-urilor: numele, apoi toate valorile numerice intr-un singur bloc.
+ * @param out Buffer-ul de iesire.
+ */
+void Province::save(BinaryWriter &out) const {
+    const std::int32_t fields[] = {
+        population, civFactories, milFactories, infrastructure, dockyards, airfields,
+        armyRF, navalRF, aerialRF, nuclearRF, steel, tungsten, aluminum, chromium, oil
+    };
+    out.writeString(name);
+    out.writeArray(fields, std::size(fields));
+}
+
+/**
+ * @brief Citeste o provincie scrisa cu save() si reconstruieste tabela de efecte.
+ * @param in Cititorul binar.
+ * @throws SnapshotException daca datele sunt trunchiate sau contin valori negative.
+ */
+void Province::load(BinaryReader &in) {
+    std::string n = in.readString();
+    std::int32_t fields[15];
+    in.readArray(fields, std::size(fields));
+    for (std::int32_t v: fields) {
+        if (v < 0) throw SnapshotException("Valoare negativa in provincia " + n);
+    }
+    name = std::move(n);
+    population = fields[0];
+    civFactories = fields[1];
+    milFactories = fields[2];
+    infrastructure = fields[3];
+    dockyards = fields[4];
+    airfields = fields[5];
+    armyRF = fields[6];
+    navalRF = fields[7];
+    aerialRF = fields[8];
+    nuclearRF = fields[9];
+    steel = fields[10];
+    tungsten = fields[11];
+    aluminum = fields[12];
+    chromium = fields[13];
+    oil = fields[14];
+    initResources();
+}
@@ -0,0 +1,83 @@
+#include "../headers/ProvinceStats.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PROVINCE_STATS_SSE2
+#endif
+
+namespace {
+    // Suma unei coloane int32. Varianta vectoriala este aleasa la compilare in functie de setul de
+    // instructiuni tinta (vezi optiunea ENABLE_AVX2 din cmake/Options.cmake); restul elementelor
+    // (si platformele fara SSE2/AVX2) folosesc bucla scalara.
+    std::int32_t sumColumn(const std::int32_t *data, std::size_t n) {
+        std::size_t i = 0;
+        std::int32_t total = 0;
+#if defined(__AVX2__)
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= n; i += 8) {
+            acc = _mm256_add_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i)));
+        }
+        __m128i half = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        total = _mm_cvtsi128_si32(half);
+#elif defined(PROVINCE_STATS_SSE2)
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= n; i += 4) {
+            acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+        }
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        total = _mm_cvtsi128_si32(acc);
+#endif
+        for (; i < n; ++i) total += data[i];
+        return total;
+    }
+}
+
+std::int32_t ProvinceStatColumns::valueOf(const Province &p, ProvinceStat s) {
+    switch (s) {
+        case ProvinceStat::Civ: return p.getCiv();
+        case ProvinceStat::Mil: return p.getMil();
+        case ProvinceStat::Infra: return p.getInfra();
+        case ProvinceStat::Dockyard: return p.getDockyards();
+        case ProvinceStat::Airfield: return p.getAirfields();
+        case ProvinceStat::Steel: return p.getSteel();
+        case ProvinceStat::Tungsten: return p.getTungsten();
+        case ProvinceStat::Aluminum: return p.getAluminum();
+        case ProvinceStat::Chromium: return p.getChromium();
+        case ProvinceStat::Oil: return p.getOil();
+    }
+    return 0;
+}
+
+void ProvinceStatColumns::assign(std::span<const Province> provinces) {
+    for (std::size_t s = 0; s < PROVINCE_STAT_COUNT; ++s) {
+        auto &col = columns[s];
+        col.resize(provinces.size());
+        for (std::size_t i = 0; i < provinces.size(); ++i) {
+            col[i] = valueOf(provinces[i], static_cast<ProvinceStat>(s));
+        }
+    }
+    versions.assign(provinces.size(), 0);
+    cached = recount();
+}
+
+void ProvinceStatColumns::update(std::size_t index, const Province &p) {
+    for (std::size_t s = 0; s < PROVINCE_STAT_COUNT; ++s) {
+        std::int32_t value = valueOf(p, static_cast<ProvinceStat>(s));
+        cached.values[s] += value - columns[s][index];
+        columns[s][index] = value;
+    }
+    ++versions[index];
+}
+
+ProvinceTotals ProvinceStatColumns::recount() const {
+    ProvinceTotals t;
+    for (std::size_t s = 0; s < PROVINCE_STAT_COUNT; ++s) {
+        t.values[s] = sumColumn(columns[s].data(), columns[s].size());
+    }
+    return t;
+}
@@ -1,6 +1,6 @@
 #include "../headers/ResourceBase.h"
 
-int AbstractResource::globalCount = 0;
+std::atomic<int> AbstractResource::globalCount{0};
 
 AbstractResource::AbstractResource(std::string name, int amount)
     : name(std::move(name)), amount(amount) {
@@ -17,9 +17,9 @@ int ResourceStockpile::getManpower() const {
     return manpower;
 }
 
-void ResourceStockpile::add(int dFuel, int dManpower) {
-    fuel = clampNonNeg(fuel + dFuel);
-    manpower = clampNonNeg(manpower + dManpower);
+void ResourceStockpile::add(long long dFuel, long long dManpower) {
+    fuel = clampToRange(fuel + dFuel);
+    manpower = clampToRange(manpower + dManpower);
 }
 
 std::string ResourceStockpile::toString() const {
@@ -0,0 +1,219 @@
+/**
+ * @file ScenarioFile.cpp
+ * @brief Citirea si scrierea scenariilor in formatul binar descris in ScenarioFile.h.
+ *
+ * La incarcare fisierul este mapat in memorie; inregistrarile si numele sunt citite direct din maparea
+ * respectiva, iar provinciile fiecarei tari sunt construite pe loc intr-un vector rezervat dinainte,
+ * fara copii intermediare (nici prin CountryBuilder, nici prin vectori temporari).
+ */
+
+#include "../headers/ScenarioFile.h"
+#include "../headers/BinaryIO.h"
+#include "../headers/GameExceptions.h"
+#include "../headers/MappedFile.h"
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+    constexpr char SCENARIO_MAGIC[8] = {'O', 'O', 'P', 'S', 'C', 'E', 'N', '\0'};
+    constexpr std::uint32_t SCENARIO_BYTE_ORDER = 0x01020304u;
+
+    // BinaryReader semnaleaza trunchierea cu SnapshotException; pentru scenarii verificam inainte de citire
+    void requireBytes(const BinaryReader &in, std::size_t bytes) {
+        if (in.remaining() < bytes) throw ScenarioException("Fisier de scenariu trunchiat");
+    }
+
+    /**
+     * @brief Citeste un numar de inregistrari de latime fixa, intorcand pointerul catre ele in sursa.
+     *
+     * Inregistrarile nu sunt copiate; fiecare este citita ulterior cu recordAt (memcpy, deci fara
+     * cerinte de aliniere asupra fisierului mapat).
+     */
+    template<typename T>
+    const char *takeRecords(BinaryReader &in, std::uint32_t count) {
+        if (count > in.remaining() / sizeof(T)) throw ScenarioException("Fisier de scenariu trunchiat");
+        return in.take(count * sizeof(T));
+    }
+
+    template<typename T>
+    T recordAt(const char *base, std::size_t index) {
+        T rec;
+        std::memcpy(&rec, base + index * sizeof(T), sizeof(T));
+        return rec;
+    }
+
+    class StringTable {
+        const char *base;
+        std::uint32_t size;
+
+    public:
+        StringTable(const char *base, std::uint32_t size) : base(base), size(size) {
+        }
+
+        std::string_view at(std::uint32_t offset, std::uint32_t length) const {
+            if (offset > size || length > size - offset)
+                throw ScenarioException("Referinta invalida in tabela de string-uri");
+            return {base + offset, length};
+        }
+    };
+
+    // construieste tabela de string-uri la salvare; numele identice sunt scrise o singura data
+    class StringTableBuilder {
+        std::string bytes;
+        std::unordered_map<std::string, std::uint32_t> offsets;
+
+    public:
+        std::pair<std::uint32_t, std::uint32_t> add(const std::string &s) {
+            auto [it, inserted] = offsets.try_emplace(s, static_cast<std::uint32_t>(bytes.size()));
+            if (inserted) bytes += s;
+            return {it->second, static_cast<std::uint32_t>(s.size())};
+        }
+
+        const std::string &data() const { return bytes; }
+    };
+}
+
+/**
+ * @brief Incarca toate tarile dintr-un fisier de scenariu.
+ * @param path Calea catre fisier.
+ * @return Tarile din scenariu, in ordinea din fisier.
+ * @throws ScenarioException daca fisierul nu are formatul asteptat.
+ * @throws GameException daca fisierul nu poate fi deschis.
+ */
+std::vector<Country> ScenarioFile::load(const std::string &path) {
+    MappedFile file(path);
+    BinaryReader in(file.data(), file.size());
+
+    requireBytes(in, sizeof(ScenarioHeader));
+    auto header = in.read<ScenarioHeader>();
+    if (std::memcmp(header.magic, SCENARIO_MAGIC, sizeof(SCENARIO_MAGIC)) != 0)
+        throw ScenarioException(path + " nu este un fisier de scenariu");
+    if (header.version != VERSION)
+        throw ScenarioException("Versiune de scenariu nesuportata: " + std::to_string(header.version));
+    if (header.byteOrder != SCENARIO_BYTE_ORDER)
+        throw ScenarioException("Scenariu scris pe o platforma cu alta ordine a octetilor");
+
+    const char *countryRecords = takeRecords<ScenarioCountryRecord>(in, header.countryCount);
+    const char *provinceRecords = takeRecords<ScenarioProvinceRecord>(in, header.provinceCount);
+    const char *lineRecords = takeRecords<ScenarioLineRecord>(in, header.lineCount);
+    requireBytes(in, header.stringBytes);
+    StringTable strings(in.take(header.stringBytes), header.stringBytes);
+
+    std::vector<Country> countries;
+    countries.reserve(header.countryCount);
+    for (std::uint32_t ci = 0; ci < header.countryCount; ++ci) {
+        auto rec = recordAt<ScenarioCountryRecord>(countryRecords, ci);
+        if (rec.firstProvince > header.provinceCount || rec.provinceCount > header.provinceCount - rec.firstProvince ||
+            rec.firstLine > header.lineCount || rec.lineCount > header.lineCount - rec.firstLine)
+            throw ScenarioException("Tara cu interval invalid de provincii sau linii de productie");
+
+        std::vector<Province> provinces;
+        provinces.reserve(rec.provinceCount);
+        for (std::uint32_t pi = rec.firstProvince; pi < rec.firstProvince + rec.provinceCount; ++pi) {
+            auto p = recordAt<ScenarioProvinceRecord>(provinceRecords, pi);
+            if (p.dockyards < 0 || p.airfields < 0 || p.armyRF < 0 || p.navalRF < 0 || p.aerialRF < 0 ||
+                p.nuclearRF < 0)
+                throw ScenarioException("Provincie cu numar negativ de cladiri");
+            Province &province = provinces.emplace_back(
+                std::string(strings.at(p.nameOffset, p.nameLength)), p.population,
+                p.civ, p.mil, p.infra, p.steel, p.tungsten, p.aluminum, p.chromium, p.oil);
+            // de obicei zero; fiecare add* reconstruieste tabela de efecte
+            if (p.dockyards) province.addDockyard(p.dockyards);
+            if (p.airfields) province.addAirfield(p.airfields);
+            if (p.armyRF) province.addArmyRF(p.armyRF);
+            if (p.navalRF) province.addNavalRF(p.navalRF);
+            if (p.aerialRF) province.addAerialRF(p.aerialRF);
+            if (p.nuclearRF) province.addNuclearRF(p.nuclearRF);
+        }
+
+        countries.emplace_back(std::string(strings.at(rec.nameOffset, rec.nameLength)),
+                               std::string(strings.at(rec.ideologyOffset, rec.ideologyLength)),
+                               std::move(provinces), ResourceStockpile(rec.fuel, rec.manpower));
+
+        Country &country = countries.back();
+        for (std::uint32_t li = rec.firstLine; li < rec.firstLine + rec.lineCount; ++li) {
+            auto line = recordAt<ScenarioLineRecord>(lineRecords, li);
+            if (!isValidEquipmentType(line.type) || line.factories < 0)
+                throw ScenarioException("Linie de productie invalida pentru " + country.getName());
+            if (line.factories > country.getFreeMilFactories())
+                throw ScenarioException("Linie de productie cu mai multe fabrici decat are " + country.getName());
+            country.addProductionLine(static_cast<EquipmentType>(line.type));
+            int index = static_cast<int>(country.getProductionLines().size()) - 1;
+            country.modifyLineFactories(index, line.factories - country.getProductionLines().back().getFactories());
+        }
+    }
+    return countries;
+}
+
+/**
+ * @brief Scrie starea initiala a tarilor (provincii cu toate cladirile, stocuri, linii de productie) ca fisier de scenariu.
+ *
+ * Coada de constructii, focus-urile si echipamentul produs nu fac parte din scenariu; pentru
+ * starea completa a unei simulari se folosesc snapshot-urile Engine.
+ *
+ * @param path Calea catre fisier.
+ * @param countries Tarile de salvat.
+ */
+void ScenarioFile::save(const std::string &path, const std::vector<Country> &countries) {
+    StringTableBuilder strings;
+    std::vector<ScenarioCountryRecord> countryRecords;
+    std::vector<ScenarioProvinceRecord> provinceRecords;
+    std::vector<ScenarioLineRecord> lineRecords;
+    countryRecords.reserve(countries.size());
+
+    for (const auto &c: countries) {
+        ScenarioCountryRecord rec{};
+        std::tie(rec.nameOffset, rec.nameLength) = strings.add(c.getName());
+        std::tie(rec.ideologyOffset, rec.ideologyLength) = strings.add(c.getIdeology());
+        rec.firstProvince = static_cast<std::uint32_t>(provinceRecords.size());
+        rec.provinceCount = static_cast<std::uint32_t>(c.getProvinces().size());
+        rec.firstLine = static_cast<std::uint32_t>(lineRecords.size());
+        rec.lineCount = static_cast<std::uint32_t>(c.getProductionLines().size());
+        rec.fuel = c.getResourceStockpile().getFuel();
+        rec.manpower = c.getResourceStockpile().getManpower();
+        countryRecords.push_back(rec);
+
+        for (const auto &p: c.getProvinces()) {
+            ScenarioProvinceRecord pr{};
+            std::tie(pr.nameOffset, pr.nameLength) = strings.add(p.getName());
+            pr.population = p.getPopulation();
+            pr.civ = p.getCiv();
+            pr.mil = p.getMil();
+            pr.infra = p.getInfra();
+            pr.steel = p.getSteel();
+            pr.tungsten = p.getTungsten();
+            pr.aluminum = p.getAluminum();
+            pr.chromium = p.getChromium();
+            pr.oil = p.getOil();
+            pr.dockyards = p.getDockyards();
+            pr.airfields = p.getAirfields();
+            pr.armyRF = p.getArmyRF();
+            pr.navalRF = p.getNavalRF();
+            pr.aerialRF = p.getAerialRF();
+            pr.nuclearRF = p.getNuclearRF();
+            provinceRecords.push_back(pr);
+        }
+        for (const auto &line: c.getProductionLines()) {
+            lineRecords.push_back({static_cast<std::uint32_t>(line.getType()), line.getFactories()});
+        }
+    }
+
+    ScenarioHeader header{};
+    std::memcpy(header.magic, SCENARIO_MAGIC, sizeof(SCENARIO_MAGIC));
+    header.version = VERSION;
+    header.byteOrder = SCENARIO_BYTE_ORDER;
+    header.countryCount = static_cast<std::uint32_t>(countryRecords.size());
+    header.provinceCount = static_cast<std::uint32_t>(provinceRecords.size());
+    header.lineCount = static_cast<std::uint32_t>(lineRecords.size());
+    header.stringBytes = static_cast<std::uint32_t>(strings.data().size());
+
+    BinaryWriter out;
+    out.write(header);
+    out.writeArray(countryRecords.data(), countryRecords.size());
+    out.writeArray(provinceRecords.data(), provinceRecords.size());
+    out.writeArray(lineRecords.data(), lineRecords.size());
+    out.writeArray(strings.data().data(), strings.data().size());
+    out.saveToFile(path);
+}
@@ -0,0 +1,71 @@
+#include "../headers/SimulationParams.h"
+#include "../headers/GameExceptions.h"
+#include <cmath>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+    // numele cladirilor in cheile cost.<cladire> / limit.<cladire>, in ordinea din BuildingType
+    constexpr std::array<std::string_view, BUILDING_TYPE_COUNT> BUILDING_KEYS{
+        "civ", "mil", "infra", "dockyard", "airfield", "armyRF", "navalRF", "aerialRF", "nuclearRF"
+    };
+
+    std::size_t buildingIndex(const std::string &key, std::string_view name) {
+        for (std::size_t i = 0; i < BUILDING_KEYS.size(); ++i) {
+            if (BUILDING_KEYS[i] == name) return i;
+        }
+        throw GameException("Cladire necunoscuta in parametrul " + key);
+    }
+
+    int parseInt(const std::string &key, const std::string &value) {
+        try {
+            std::size_t used = 0;
+            int v = std::stoi(value, &used);
+            if (used == value.size()) return v;
+        } catch (const std::logic_error &) {
+        }
+        throw GameException("Valoare invalida pentru " + key + ": " + value);
+    }
+
+    double parseDouble(const std::string &key, const std::string &value) {
+        try {
+            std::size_t used = 0;
+            double v = std::stod(value, &used);
+            if (used == value.size()) return v;
+        } catch (const std::logic_error &) {
+        }
+        throw GameException("Valoare invalida pentru " + key + ": " + value);
+    }
+}
+
+void SimulationParams::set(const std::string &key, const std::string &value) {
+    std::string_view k = key;
+    if (k == "milOutput") milOutput = parseInt(key, value);
+    else if (k == "oilToFuel") oilToFuel = parseInt(key, value);
+    else if (k == "civOutputPerDay") civOutputPerDay = parseDouble(key, value);
+    else if (k == "factoriesPerConstructionSlot") factoriesPerConstructionSlot = parseInt(key, value);
+    else if (k.starts_with("cost.")) buildingCost[buildingIndex(key, k.substr(5))] = parseDouble(key, value);
+    else if (k.starts_with("limit.")) buildingLimit[buildingIndex(key, k.substr(6))] = parseInt(key, value);
+    else if (k.starts_with("focus.")) {
+        int index = parseInt(key, std::string(k.substr(6)));
+        if (index < 0 || static_cast<std::size_t>(index) >= focusDays.size())
+            throw GameException("Focus inexistent in parametrul " + key);
+        focusDays[static_cast<std::size_t>(index)] = parseInt(key, value);
+    } else {
+        throw GameException("Parametru de simulare necunoscut: " + key);
+    }
+}
+
+void SimulationParams::validate() const {
+    if (milOutput < 0 || oilToFuel < 0) throw GameException("Productia nu poate fi negativa");
+    if (!std::isfinite(civOutputPerDay) || civOutputPerDay <= 0 || factoriesPerConstructionSlot <= 0)
+        throw GameException("Productia civila si sloturile de constructie trebuie sa fie finite si pozitive");
+    for (std::size_t i = 0; i < BUILDING_TYPE_COUNT; ++i) {
+        if (!std::isfinite(buildingCost[i]) || buildingCost[i] <= 0)
+            throw GameException("Cost invalid pentru " + std::string(BUILDING_KEYS[i]));
+        if (buildingLimit[i] < 0) throw GameException("Limita invalida pentru " + std::string(BUILDING_KEYS[i]));
+    }
+    for (int days: focusDays) {
+        if (days < 1) throw GameException("Durata unui focus trebuie sa fie de cel putin o zi");
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file SimulationThread.cpp
+ * @brief Bucla simularii pe un thread separat de interfata: zile la ritm fix, comenzi din coada si
+ *        publicarea snapshot-urilor imutabile.
+ */
+
+#include "../headers/SimulationThread.h"
+#include "../headers/GameExceptions.h"
+#include "../headers/Profiler.h"
+#include <iostream>
+
+/**
+ * @brief Pregateste thread-ul simularii si publica snapshot-ul starii initiale.
+ * @param engine Engine-ul simulat; trebuie sa traiasca mai mult decat acest obiect.
+ * @param tickPeriod Durata reala a unei zile simulate.
+ */
+SimulationThread::SimulationThread(Engine &engine, std::chrono::steady_clock::duration tickPeriod)
+    : engine(engine), tickPeriod(tickPeriod) {
+    publish(-1);
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::start() {
+    if (worker.joinable()) return;
+    {
+        std::lock_guard lock(mutex);
+        stopRequested = false;
+    }
+    worker = std::thread([this] { loop(); });
+}
+
+void SimulationThread::stop() {
+    {
+        std::lock_guard lock(mutex);
+        stopRequested = true;
+    }
+    wake.notify_one();
+    if (worker.joinable()) worker.join();
+}
+
+void SimulationThread::setRunning(bool run) {
+    {
+        std::lock_guard lock(mutex);
+        if (running == run) return;
+        running = run;
+    }
+    wake.notify_one();
+}
+
+void SimulationThread::post(const EngineCommand &command) {
+    {
+        std::lock_guard lock(mutex);
+        commands.push_back(command);
+    }
+    wake.notify_one();
+}
+
+void SimulationThread::watch(int countryIndex) {
+    {
+        std::lock_guard lock(mutex);
+        if (watched == countryIndex) return;
+        watched = countryIndex;
+        republish = true;
+    }
+    wake.notify_one();
+}
+
+std::shared_ptr<const WorldSnapshot> SimulationThread::snapshot() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+    return latest.load(std::memory_order_acquire);
+#else
+    std::lock_guard lock(latestMutex);
+    return latest;
+#endif
+}
+
+/**
+ * @brief Bucla thread-ului: aplica comenzile cand sosesc si simuleaza o zi la fiecare tickPeriod.
+ *
+ * Termenul urmatoarei zile avanseaza cu tickPeriod dupa fiecare zi, deci intarzierile mici sunt
+ * recuperate. Dupa o intarziere mai mare de o zi (de ex. sistemul a fost suspendat), zilele pierdute
+ * nu mai sunt simulate in rafala: ritmul reincepe de la momentul curent.
+ */
+void SimulationThread::loop() {
+    using Clock = std::chrono::steady_clock;
+    auto nextTick = Clock::now() + tickPeriod;
+
+    std::unique_lock lock(mutex);
+    while (true) {
+        if (!commands.empty() || republish) {
+            std::vector<EngineCommand> batch;
+            batch.swap(commands);
+            republish = false;
+            int watchedCountry = watched;
+            lock.unlock();
+            for (const auto &c: batch) apply(c);
+            publish(watchedCountry);
+            lock.lock();
+            continue;
+        }
+        if (stopRequested) break;
+        if (!running) {
+            wake.wait(lock);
+            nextTick = Clock::now() + tickPeriod;
+            continue;
+        }
+        if (Clock::now() < nextTick) {
+            wake.wait_until(lock, nextTick);
+            continue;
+        }
+
+        int watchedCountry = watched;
+        lock.unlock();
+        {
+            PROFILE_SCOPE("sim.tick");
+            engine.simulateOneDay();
+        }
+        publish(watchedCountry);
+        nextTick += tickPeriod;
+        if (Clock::now() > nextTick + tickPeriod) nextTick = Clock::now() + tickPeriod;
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Aplica o comanda; erorile de joc (de ex. limita de cladiri atinsa) sunt doar raportate.
+ * @param command Comanda de aplicat.
+ */
+void SimulationThread::apply(const EngineCommand &command) {
+    try {
+        engine.execute(command);
+    } catch (const GameException &e) {
+        std::cerr << e.what() << "\n";
+    }
+}
+
+/**
+ * @brief Publica un snapshot nou al lumii.
+ *
+ * Doar tara urmarita este adusa la zi; celelalte sunt citite fara sincronizare (Engine::peekCountry),
+ * deci o tara fara evenimente isi pastreaza versiunea si este preluata din snapshot-ul anterior fara
+ * copiere. Apelata doar de thread-ul simularii (sau din constructor, inainte de start), deci snapshot-ul
+ * anterior nu poate fi inlocuit intre citirea si scrierea lui.
+ *
+ * @param watchedCountry Tara adusa la ziua curenta (-1 = niciuna).
+ */
+void SimulationThread::publish(int watchedCountry) {
+    PROFILE_SCOPE("sim.publish");
+    std::shared_ptr<const WorldSnapshot> previous = snapshot();
+    const std::size_t count = engine.getCountryCount();
+    if (watchedCountry >= 0 && static_cast<std::size_t>(watchedCountry) < count) engine.getCountry(watchedCountry);
+
+    auto next = std::make_shared<WorldSnapshot>();
+    next->day = engine.getDay();
+    next->countries.reserve(count);
+    next->countryVersions.reserve(count);
+    next->countryDays.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const int ci = static_cast<int>(i);
+        std::uint64_t version = engine.peekCountryVersion(ci);
+        if (previous && i < previous->countries.size() && previous->countryVersions[i] == version) {
+            next->countries.push_back(previous->countries[i]);
+        } else {
+            next->countries.push_back(std::make_shared<const Country>(engine.peekCountry(ci)));
+        }
+        next->countryVersions.push_back(version);
+        next->countryDays.push_back(engine.getSyncedDay(ci));
+    }
+
+    std::shared_ptr<const WorldSnapshot> published = std::move(next);
+#if defined(__cpp_lib_atomic_shared_ptr)
+    latest.store(std::move(published), std::memory_order_release);
+#else
+    std::lock_guard lock(latestMutex);
+    latest = std::move(published);
+#endif
+}
@@ -0,0 +1,162 @@
+/**
+ * @file TelemetryWriter.cpp
+ * @brief Scrierea telemetriei zilnice pe un thread separat, in blocuri pe coloane.
+ */
+
+#include "../headers/TelemetryWriter.h"
+#include "../headers/BinaryIO.h"
+#include "../headers/GameExceptions.h"
+#include <chrono>
+#include <exception>
+#include <iterator>
+
+namespace {
+    constexpr char TELEMETRY_MAGIC[8] = {'O', 'O', 'P', 'T', 'E', 'L', 'E', 'M'};
+    constexpr std::uint32_t TELEMETRY_BYTE_ORDER = 0x01020304u;
+
+    struct IntColumn {
+        const char *name;
+        std::int32_t TelemetryRecord::*field;
+    };
+
+    // coloanele int32, in ordinea din fisier; urmeaza coloanele de echipament
+    constexpr IntColumn INT_COLUMNS[] = {
+        {"day", &TelemetryRecord::day},
+        {"country", &TelemetryRecord::country},
+        {"fuel", &TelemetryRecord::fuel},
+        {"manpower", &TelemetryRecord::manpower},
+        {"civFactories", &TelemetryRecord::civFactories},
+        {"milFactories", &TelemetryRecord::milFactories},
+        {"usedMilFactories", &TelemetryRecord::usedMilFactories},
+        {"queuedConstructions", &TelemetryRecord::queuedConstructions},
+    };
+    constexpr std::size_t INT_COLUMN_COUNT = std::size(INT_COLUMNS);
+
+    // cat asteapta thread-ul de scriere cand bufferul este gol
+    constexpr std::chrono::milliseconds IDLE_WAIT{1};
+}
+
+/**
+ * @brief Deschide fisierul, scrie header-ul si porneste thread-ul de scriere.
+ * @param path Calea fisierului de telemetrie (suprascris).
+ * @param overflow Comportamentul lui append() cand bufferul este plin.
+ * @param capacity Numarul de randuri din buffer (rotunjit la o putere a lui 2).
+ * @throws TelemetryException daca fisierul nu poate fi creat.
+ */
+TelemetryWriter::TelemetryWriter(const std::string &path, TelemetryOverflow overflow, std::size_t capacity)
+    : path(path), overflow(overflow), ring(capacity), out(path, std::ios::binary | std::ios::trunc),
+      intColumns(INT_COLUMN_COUNT), equipmentColumns(EQUIPMENT_TYPE_COUNT) {
+    if (!out) throw TelemetryException("Nu se poate scrie fisierul " + path);
+    for (auto &col: intColumns) col.reserve(BLOCK_ROWS);
+    for (auto &col: equipmentColumns) col.reserve(BLOCK_ROWS);
+    writeHeader();
+    worker = std::thread([this] { loop(); });
+}
+
+TelemetryWriter::~TelemetryWriter() {
+    try {
+        close();
+    } catch (const GameException &) {
+        // destructorul nu poate raporta eroarea; cine are nevoie de ea apeleaza close() explicit
+    }
+}
+
+/**
+ * @brief Adauga un rand. Nu face I/O; cu TelemetryOverflow::Drop nu asteapta niciodata.
+ * @param record Randul de adaugat.
+ */
+void TelemetryWriter::append(const TelemetryRecord &record) {
+    while (!ring.tryPush(record)) {
+        if (overflow == TelemetryOverflow::Drop || failed.load(std::memory_order_acquire)) {
+            droppedRows.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+void TelemetryWriter::close() {
+    if (worker.joinable()) {
+        closing.store(true, std::memory_order_release);
+        worker.join();
+    }
+    if (failed.load(std::memory_order_acquire)) throw TelemetryException(error);
+}
+
+void TelemetryWriter::writeHeader() {
+    BinaryWriter header;
+    header.writeArray(TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC));
+    header.write(VERSION);
+    header.write(TELEMETRY_BYTE_ORDER);
+    header.write(static_cast<std::uint32_t>(INT_COLUMN_COUNT + EQUIPMENT_TYPE_COUNT));
+    for (const auto &col: INT_COLUMNS) {
+        header.writeString(col.name);
+        header.write(static_cast<std::uint32_t>(sizeof(std::int32_t)));
+    }
+    for (const auto &info: EQUIPMENT_CATALOG) {
+        header.writeString("equipment." + std::string(info.shortName));
+        header.write(static_cast<std::uint32_t>(sizeof(std::int64_t)));
+    }
+    writeBytes(header.data().data(), header.data().size());
+}
+
+/**
+ * @brief Bucla thread-ului de scriere: goleste bufferul in blocul curent si scrie blocurile pline.
+ *
+ * Dupa close() mai goleste o data bufferul (randurile adaugate inainte de close() sunt vizibile dupa
+ * citirea lui `closing`), scrie ultimul bloc si finalul fisierului. O eroare de scriere opreste bucla;
+ * randurile adaugate ulterior sunt numarate ca pierdute.
+ */
+void TelemetryWriter::loop() {
+    std::vector<TelemetryRecord> batch(1024);
+    try {
+        while (true) {
+            std::size_t n = ring.popInto(batch.data(), batch.size());
+            if (n == 0) {
+                if (closing.load(std::memory_order_acquire)) {
+                    n = ring.popInto(batch.data(), batch.size());
+                    if (n == 0) break;
+                } else {
+                    std::this_thread::sleep_for(IDLE_WAIT);
+                    continue;
+                }
+            }
+            for (std::size_t i = 0; i < n; ++i) addRow(batch[i]);
+        }
+        flushBlock();
+        const std::uint32_t endMarker = 0;
+        const std::uint64_t lost = droppedRows.load(std::memory_order_relaxed);
+        writeBytes(&endMarker, sizeof(endMarker));
+        writeBytes(&lost, sizeof(lost));
+        out.close();
+        if (!out) throw TelemetryException("Eroare la inchiderea fisierului " + path);
+    } catch (const std::exception &e) {
+        error = e.what();
+        failed.store(true, std::memory_order_release);
+    }
+}
+
+void TelemetryWriter::addRow(const TelemetryRecord &record) {
+    for (std::size_t c = 0; c < INT_COLUMN_COUNT; ++c) intColumns[c].push_back(record.*INT_COLUMNS[c].field);
+    for (std::size_t e = 0; e < EQUIPMENT_TYPE_COUNT; ++e) equipmentColumns[e].push_back(record.equipment[e]);
+    if (intColumns[0].size() == BLOCK_ROWS) flushBlock();
+}
+
+void TelemetryWriter::flushBlock() {
+    const auto rows = static_cast<std::uint32_t>(intColumns[0].size());
+    if (rows == 0) return;
+    writeBytes(&rows, sizeof(rows));
+    for (auto &col: intColumns) {
+        writeBytes(col.data(), col.size() * sizeof(std::int32_t));
+        col.clear();
+    }
+    for (auto &col: equipmentColumns) {
+        writeBytes(col.data(), col.size() * sizeof(std::int64_t));
+        col.clear();
+    }
+}
+
+void TelemetryWriter::writeBytes(const void *data, std::size_t size) {
+    out.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    if (!out) throw TelemetryException("Eroare la scrierea fisierului " + path);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file TextureAtlas.cpp
+ * @brief Construirea atlasului de iconite folosit de interfata grafica.
+ */
+
+#include "../headers/TextureAtlas.h"
+#include "../headers/GameExceptions.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    constexpr unsigned PADDING = 1;
+}
+
+/**
+ * @brief Incarca imaginile si le copiaza intr-o singura textura.
+ *
+ * Imaginile sunt asezate de la stanga la dreapta; cand randul curent ar depasi latimea maxima
+ * a unei texturi, se trece pe un rand nou, sub cea mai inalta imagine de pe randul anterior.
+ * O imagine lipsa este raportata pe stderr (la fel ca celelalte resurse ale interfetei), iar
+ * regiunea ei ramane goala.
+ *
+ * @param paths Caile imaginilor, in ordinea indicilor folositi la getRegion.
+ * @throws AssetLoadException daca textura atlasului nu poate fi creata.
+ */
+void TextureAtlas::build(const std::vector<std::string> &paths) {
+    const unsigned maxWidth = std::min(2048u, sf::Texture::getMaximumSize());
+
+    std::vector<sf::Image> images(paths.size());
+    regions.assign(paths.size(), sf::IntRect());
+
+    unsigned x = 0, y = 0, rowHeight = 0, width = 0;
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        if (!images[i].loadFromFile(paths[i])) {
+            std::cerr << "Lipseste " << paths[i] << "\n";
+            continue;
+        }
+        sf::Vector2u size = images[i].getSize();
+        if (x > 0 && x + size.x > maxWidth) {
+            x = 0;
+            y += rowHeight + PADDING;
+            rowHeight = 0;
+        }
+        regions[i] = sf::IntRect(static_cast<int>(x), static_cast<int>(y),
+                                 static_cast<int>(size.x), static_cast<int>(size.y));
+        x += size.x + PADDING;
+        rowHeight = std::max(rowHeight, size.y);
+        width = std::max(width, x);
+    }
+    unsigned height = y + rowHeight;
+    if (width == 0 || height == 0) return;
+
+    sf::Image atlas;
+    atlas.create(width, height, sf::Color::Transparent);
+    for (std::size_t i = 0; i < images.size(); ++i) {
+        if (regions[i].width == 0) continue;
+        atlas.copy(images[i], static_cast<unsigned>(regions[i].left), static_cast<unsigned>(regions[i].top));
+    }
+    if (!texture.loadFromImage(atlas)) throw AssetLoadException("atlasul de iconite");
+}
+
+const sf::Texture &TextureAtlas::getTexture() const { return texture; }
+
+const sf::IntRect &TextureAtlas::getRegion(std::size_t index) const { return regions.at(index); }
@@ -0,0 +1,81 @@
+#include "../headers/ThreadPool.h"
+
+ThreadPool::ThreadPool(unsigned extraThreads) {
+    workers.reserve(extraThreads);
+    for (unsigned i = 0; i < extraThreads; ++i) {
+        workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (auto &w: workers) w.join();
+}
+
+void ThreadPool::runJob(const std::function<void(std::size_t)> &fn, std::size_t count) {
+    for (std::size_t i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1)) {
+        try {
+            fn(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    std::uint64_t seen = 0;
+    while (true) {
+        const std::function<void(std::size_t)> *fn;
+        std::size_t count;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeWorkers.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            fn = job;
+            count = jobSize;
+        }
+
+        runJob(*fn, count);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--busyWorkers == 0) jobDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)> &fn) {
+    if (workers.empty() || count <= 1) {
+        for (std::size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &fn;
+        jobSize = count;
+        nextIndex.store(0);
+        busyWorkers = workers.size();
+        error = nullptr;
+        ++generation;
+    }
+    wakeWorkers.notify_all();
+
+    runJob(fn, count);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [&] { return busyWorkers == 0; });
+    job = nullptr;
+
+    if (error) {
+        std::exception_ptr e = error;
+        error = nullptr;
+        std::rethrow_exception(e);
+    }
+}
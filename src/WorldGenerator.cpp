@@ -0,0 +1,174 @@
+/**
+ * @file WorldGenerator.cpp
+ * @brief Generator determinist de lumi sintetice (N tari x M provincii) pentru teste de scalare si benchmark-uri.
+ *
+ * Fiecare valoare aleatoare este citita din CounterRng, indexata dupa (seed, provincie, tara, statistica),
+ * deci lumea nu depinde de ordinea de generare. Tarile sunt construite prin CountryBuilder, iar liniile de
+ * productie, constructiile si focus-ul activ sunt adaugate prin API-ul public al Country.
+ */
+
+#include "../headers/WorldGenerator.h"
+#include "../headers/CountryBuilder.h"
+#include "../headers/CounterRng.h"
+#include "../headers/GameExceptions.h"
+#include <array>
+#include <sstream>
+
+namespace {
+    // contoare fixe pentru fiecare valoare aleatoare a unei provincii / tari
+    enum class Draw : std::uint32_t {
+        Population, Civ, Mil, Infra, Steel, Tungsten, Aluminum, Chromium, Oil,
+        Focus, ConstructionType, ConstructionProvince
+    };
+
+    constexpr std::array<const char *, 4> IDEOLOGIES{"Democratic", "Authoritarian", "Communist", "Fascist"};
+
+    constexpr std::array<BuildingType, 5> QUEUED_TYPES{
+        BuildingType::Civ, BuildingType::Mil, BuildingType::Infra, BuildingType::Dockyard, BuildingType::Airfield
+    };
+
+    int uniform(const CounterRng &rng, std::int64_t key, Draw draw, StatRange range) {
+        if (range.max <= range.min) return range.min;
+        auto span = static_cast<std::uint32_t>(range.max - range.min + 1);
+        return range.min + static_cast<int>(rng.below(span, key, static_cast<std::uint32_t>(draw)));
+    }
+
+    /**
+     * @brief Citeste un interval "min-max" (sau o singura valoare) pentru o statistica.
+     * @throws ScenarioException daca valoarea nu este valida.
+     */
+    StatRange parseRange(const std::string &key, const std::string &value) {
+        try {
+            auto dash = value.find('-', 1);
+            if (dash == std::string::npos) {
+                int v = std::stoi(value);
+                return {v, v};
+            }
+            StatRange r{std::stoi(value.substr(0, dash)), std::stoi(value.substr(dash + 1))};
+            if (r.min > r.max) throw ScenarioException("Interval invalid pentru " + key + ": " + value);
+            return r;
+        } catch (const std::logic_error &) {
+            throw ScenarioException("Valoare invalida pentru " + key + ": " + value);
+        }
+    }
+
+    int parseInt(const std::string &key, const std::string &value) {
+        try {
+            return std::stoi(value);
+        } catch (const std::logic_error &) {
+            throw ScenarioException("Valoare invalida pentru " + key + ": " + value);
+        }
+    }
+}
+
+/**
+ * @brief Interpreteaza un nume de scenariu "synthetic:cheie=valoare,...".
+ *
+ * Chei: countries, provinces, seed, lines, queued, focus (0/1) si intervalele statisticilor
+ * population, civ, mil, infra, steel, tungsten, aluminum, chromium, oil (de forma "min-max").
+ *
+ * @param scenario Numele scenariului (cu prefixul SCENARIO_PREFIX).
+ * @return Descrierea lumii.
+ * @throws ScenarioException pentru chei necunoscute sau valori invalide.
+ */
+WorldSpec WorldGenerator::parseSpec(const std::string &scenario) {
+    WorldSpec spec;
+    std::string body = scenario.substr(std::string(SCENARIO_PREFIX).size());
+    std::stringstream ss(body);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        auto eq = item.find('=');
+        if (eq == std::string::npos) throw ScenarioException("Parametru fara valoare: " + item);
+        std::string key = item.substr(0, eq);
+        std::string value = item.substr(eq + 1);
+
+        if (key == "countries") spec.countries = parseInt(key, value);
+        else if (key == "provinces") spec.provincesPerCountry = parseInt(key, value);
+        else if (key == "seed") {
+            try {
+                spec.seed = std::stoull(value);
+            } catch (const std::logic_error &) {
+                throw ScenarioException("Valoare invalida pentru seed: " + value);
+            }
+        } else if (key == "lines") spec.productionLines = parseInt(key, value);
+        else if (key == "queued") spec.queuedConstructions = parseInt(key, value);
+        else if (key == "focus") spec.activeFocus = parseInt(key, value) != 0;
+        else if (key == "population") spec.population = parseRange(key, value);
+        else if (key == "civ") spec.civ = parseRange(key, value);
+        else if (key == "mil") spec.mil = parseRange(key, value);
+        else if (key == "infra") spec.infra = parseRange(key, value);
+        else if (key == "steel") spec.steel = parseRange(key, value);
+        else if (key == "tungsten") spec.tungsten = parseRange(key, value);
+        else if (key == "aluminum") spec.aluminum = parseRange(key, value);
+        else if (key == "chromium") spec.chromium = parseRange(key, value);
+        else if (key == "oil") spec.oil = parseRange(key, value);
+        else throw ScenarioException("Parametru necunoscut pentru lumea sintetica: " + key);
+    }
+    if (spec.countries < 0 || spec.provincesPerCountry < 1 || spec.productionLines < 0 || spec.queuedConstructions < 0)
+        throw ScenarioException("Dimensiuni invalide pentru lumea sintetica");
+    return spec;
+}
+
+/**
+ * @brief Genereaza lumea descrisa de spec.
+ * @param spec Descrierea lumii.
+ * @param params Constantele de echilibru aplicate fiecarei tari.
+ * @return Tarile generate (countries x provincesPerCountry provincii).
+ */
+std::vector<Country> WorldGenerator::generate(const WorldSpec &spec, const SimulationParams &params) {
+    std::vector<Country> world;
+    world.reserve(static_cast<std::size_t>(spec.countries));
+
+    for (int ci = 0; ci < spec.countries; ++ci) {
+        CounterRng rng(spec.seed, static_cast<std::uint32_t>(ci));
+
+        CountryBuilder builder;
+        builder.setName("Country " + std::to_string(ci))
+                .setIdeology(IDEOLOGIES[static_cast<std::size_t>(ci) % IDEOLOGIES.size()])
+                .setStockpile(0, 100)
+                .reserveProvinces(static_cast<std::size_t>(spec.provincesPerCountry));
+        for (int pi = 0; pi < spec.provincesPerCountry; ++pi) {
+            builder.emplaceProvince("Province " + std::to_string(ci) + "-" + std::to_string(pi),
+                                    uniform(rng, pi, Draw::Population, spec.population),
+                                    uniform(rng, pi, Draw::Civ, spec.civ),
+                                    uniform(rng, pi, Draw::Mil, spec.mil),
+                                    uniform(rng, pi, Draw::Infra, spec.infra),
+                                    uniform(rng, pi, Draw::Steel, spec.steel),
+                                    uniform(rng, pi, Draw::Tungsten, spec.tungsten),
+                                    uniform(rng, pi, Draw::Aluminum, spec.aluminum),
+                                    uniform(rng, pi, Draw::Chromium, spec.chromium),
+                                    uniform(rng, pi, Draw::Oil, spec.oil));
+        }
+        Country country = std::move(builder).build();
+        country.setParams(params);
+
+        if (spec.productionLines > 0) {
+            int share = country.getFreeMilFactories() / spec.productionLines;
+            for (int li = 0; li < spec.productionLines; ++li) {
+                country.addProductionLine(static_cast<EquipmentType>(static_cast<std::size_t>(li) % EQUIPMENT_TYPE_COUNT));
+                int assigned = country.getProductionLines().back().getFactories();
+                country.modifyLineFactories(li, share - assigned);
+            }
+        }
+
+        for (int k = 0; k < spec.queuedConstructions; ++k) {
+            auto type = QUEUED_TYPES[static_cast<std::size_t>(
+                uniform(rng, k, Draw::ConstructionType, {0, static_cast<int>(QUEUED_TYPES.size()) - 1}))];
+            int province = uniform(rng, k, Draw::ConstructionProvince, {0, spec.provincesPerCountry - 1});
+            try {
+                country.addConstruction(type, province);
+            } catch (const GameException &) {
+                // provincia a atins limita pentru tipul ales; constructia este sarita
+            }
+        }
+
+        if (spec.activeFocus) {
+            constexpr int lastFocus = static_cast<int>(FocusTree::FOCUS_COUNT) - 1;
+            country.startFocus(uniform(rng, 0, Draw::Focus, {0, lastFocus}));
+        }
+
+        world.push_back(std::move(country));
+    }
+    return world;
+}
@@ -0,0 +1,302 @@
+/**
+ * @file benchmark_main.cpp
+ * @brief Benchmark-uri pentru nucleul simularii (fara interfata grafica), cu rezultate in format JSON.
+ *
+ * Utilizare:
+ *  oop_bench [--out fisier.json] [--sizes 10,100,1000,10000,100000] [--min-time secunde] [--filter text]
+ *            [--replay jurnal]
+ *
+ *  - --out: fisierul JSON cu rezultatele (implicit stdout)
+ *  - --sizes: numerele de provincii ale lumilor sintetice masurate
+ *  - --min-time: timpul minim masurat pentru fiecare benchmark (implicit 0.2 s)
+ *  - --filter: ruleaza doar benchmark-urile al caror nume contine textul dat
+ *  - --replay: masoara si reluarea unei sesiuni inregistrate (benchmark-ul journal_replay)
+ *
+ * Fiecare benchmark repeta un esantion (setup nemasurat + corp masurat) pana se atinge --min-time
+ * si raporteaza mediana si minimul timpului pe operatie.
+ */
+
+#include "../headers/CommandJournal.h"
+#include "../headers/Engine.h"
+#include "../headers/ProductionQueue.h"
+#include "../headers/WorldGenerator.h"
+#include "../headers/GameExceptions.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct BenchResult {
+        std::string name;
+        std::size_t provinces;
+        std::size_t samples;
+        long long opsPerSample;
+        double nsPerOpMedian;
+        double nsPerOpMin;
+    };
+
+    struct BenchConfig {
+        std::vector<std::size_t> sizes{10, 100, 1000, 10000, 100000};
+        double minTime = 0.2;
+        std::string filter;
+        std::string replayPath;
+    };
+
+    // impiedica eliminarea de catre optimizator a rezultatelor calculate doar pentru masurare
+    volatile long long sink = 0;
+
+    /**
+     * @brief Masoara un benchmark: `setup()` pregateste starea (nemasurat), `body(state)` executa
+     *        `opsPerSample` operatii (masurat).
+     */
+    template<typename Setup, typename Body>
+    BenchResult measure(const std::string &name, std::size_t provinces, long long opsPerSample,
+                        double minTime, Setup setup, Body body) {
+        std::vector<double> nsPerOp;
+        double total = 0;
+        while (total < minTime || nsPerOp.size() < 3) {
+            auto state = setup();
+            auto start = Clock::now();
+            body(state);
+            double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            total += elapsed;
+            nsPerOp.push_back(elapsed * 1e9 / static_cast<double>(opsPerSample));
+            if (nsPerOp.size() >= 10000) break;
+        }
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+        return {name, provinces, nsPerOp.size(), opsPerSample, nsPerOp[nsPerOp.size() / 2], nsPerOp.front()};
+    }
+
+    Province makeProvince(std::size_t i) {
+        int v = static_cast<int>(i);
+        return Province("P" + std::to_string(i), 1000 + v % 997, v % 4, 1 + v % 3, 3 + v % 3,
+                        v % 6, v % 4, v % 5, v % 3, v % 4);
+    }
+
+    constexpr std::size_t MAX_PROVINCES_PER_COUNTRY = 500;
+
+    // numarul real de provincii din worldScenario(provinces): tarile au toate aceeasi marime,
+    // deci dimensiunile peste 500 sunt rotunjite in jos la un multiplu de 500
+    std::size_t worldProvinces(std::size_t provinces) {
+        std::size_t perCountry = std::min(provinces, MAX_PROVINCES_PER_COUNTRY);
+        return provinces / perCountry * perCountry;
+    }
+
+    // lume sintetica cu tari de cel mult 500 de provincii, fiecare cu linii de productie,
+    // constructii in coada si un focus activ, ca zilele simulate sa contina evenimente
+    std::string worldScenario(std::size_t provinces) {
+        std::size_t perCountry = std::min(provinces, MAX_PROVINCES_PER_COUNTRY);
+        return std::string(WorldGenerator::SCENARIO_PREFIX) + "countries=" + std::to_string(provinces / perCountry) +
+               ",provinces=" + std::to_string(perCountry) + ",queued=100,seed=1";
+    }
+
+    Country makeCountry(std::size_t provinces) {
+        WorldSpec spec;
+        spec.countries = 1;
+        spec.provincesPerCountry = static_cast<int>(provinces);
+        spec.queuedConstructions = 0;
+        spec.activeFocus = false;
+        return std::move(WorldGenerator::generate(spec).front());
+    }
+
+    void runSizeBenchmarks(std::size_t n, const BenchConfig &cfg, std::vector<BenchResult> &out) {
+        auto wanted = [&cfg](std::string_view name) {
+            return cfg.filter.empty() || name.find(cfg.filter) != std::string::npos;
+        };
+        const Country base = makeCountry(n);
+        auto ops = static_cast<long long>(n);
+
+        if (wanted("province_init_resources")) {
+            out.push_back(measure("province_init_resources", n, ops, cfg.minTime,
+                                  [] { return 0; },
+                                  [n](int) {
+                                      for (std::size_t i = 0; i < n; ++i) sink = sink + makeProvince(i).getCiv();
+                                  }));
+        }
+        if (wanted("province_copy")) {
+            out.push_back(measure("province_copy", n, ops, cfg.minTime,
+                                  [] { return 0; },
+                                  [&base](int) {
+                                      for (const auto &p: base.getProvinces()) {
+                                          Province copy(p);
+                                          sink = sink + copy.getMil();
+                                      }
+                                  }));
+        }
+        if (wanted("country_copy")) {
+            out.push_back(measure("country_copy", n, 1, cfg.minTime,
+                                  [] { return 0; },
+                                  [&base](int) {
+                                      Country copy(base);
+                                      sink = sink + copy.totalCiv();
+                                  }));
+        }
+        if (wanted("country_simulate_day")) {
+            out.push_back(measure("country_simulate_day", n, 10, cfg.minTime,
+                                  [&base] { return Country(base); },
+                                  [](Country &c) {
+                                      for (int d = 0; d < 10; ++d) c.simulateDay();
+                                      sink = sink + c.getResourceStockpile().getFuel();
+                                  }));
+        }
+        if (wanted("country_add_construction")) {
+            out.push_back(measure("country_add_construction", n, ops, cfg.minTime,
+                                  [&base] { return Country(base); },
+                                  [n](Country &c) {
+                                      for (std::size_t i = 0; i < n; ++i)
+                                          c.addConstruction(BuildingType::ArmyRF, static_cast<int>(i));
+                                  }));
+        }
+        if (wanted("queue_remove_first")) {
+            out.push_back(measure("queue_remove_first", n, ops, cfg.minTime,
+                                  [n] {
+                                      ProductionQueue<Construction> q;
+                                      for (std::size_t i = 0; i < n; ++i)
+                                          q.add(Construction(BuildingType::Civ, static_cast<int>(i), 100));
+                                      return q;
+                                  },
+                                  [](ProductionQueue<Construction> &q) {
+                                      while (!q.isEmpty()) q.removeFirst();
+                                  }));
+        }
+
+        bool engineWanted = wanted("engine_simulate_one_day") || wanted("engine_days_per_second");
+        if (!engineWanted) return;
+        std::string world = worldScenario(n);
+        const std::size_t worldSize = worldProvinces(n);
+        if (wanted("engine_simulate_one_day")) {
+            out.push_back(measure("engine_simulate_one_day", worldSize, 30, cfg.minTime,
+                                  [&world] { return std::make_unique<Engine>(world); },
+                                  [](std::unique_ptr<Engine> &e) { e->simulateDays(30); }));
+        }
+        if (wanted("engine_days_per_second")) {
+            constexpr int YEARS = 10;
+            out.push_back(measure("engine_days_per_second", worldSize, 365 * YEARS, cfg.minTime,
+                                  [&world] { return std::make_unique<Engine>(world); },
+                                  [](std::unique_ptr<Engine> &e) { e->advance(365 * YEARS); }));
+        }
+    }
+
+    // reluarea completa a unui jurnal (CommandJournal); o operatie = o zi simulata
+    void runReplayBenchmark(const BenchConfig &cfg, std::vector<BenchResult> &out) {
+        const CommandJournal journal = CommandJournal::load(cfg.replayPath);
+        auto makeEngine = [&journal] { return std::make_unique<Engine>(journal.getScenario(), journal.getSeed()); };
+        std::size_t provinces = 0;
+        auto probe = makeEngine();
+        for (const auto &c: probe->getCountries()) provinces += c.getProvinces().size();
+        long long days = std::max(1, journal.getEndDay() - journal.getStartDay());
+        out.push_back(measure("journal_replay", provinces, days, cfg.minTime, makeEngine,
+                              [&journal](std::unique_ptr<Engine> &e) { journal.replay(*e); }));
+    }
+
+    std::string jsonEscape(const std::string &s) {
+        std::string r;
+        for (char ch: s) {
+            if (ch == '"' || ch == '\\') r += '\\';
+            r += ch;
+        }
+        return r;
+    }
+
+    void writeJson(std::ostream &os, const std::vector<BenchResult> &results) {
+        os << "{\n  \"format_version\": 1,\n";
+#ifdef NDEBUG
+        os << "  \"build\": \"release\",\n";
+#else
+        os << "  \"build\": \"debug\",\n";
+#endif
+        os << "  \"compiler\": \"" << jsonEscape(
+#if defined(__clang__)
+            "clang " __clang_version__
+#elif defined(__GNUC__)
+            "gcc " __VERSION__
+#elif defined(_MSC_VER)
+            "msvc " + std::to_string(_MSC_VER)
+#else
+            "unknown"
+#endif
+        ) << "\",\n  \"results\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto &r = results[i];
+            os << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"provinces\": " << r.provinces
+                    << ", \"samples\": " << r.samples << ", \"ops_per_sample\": " << r.opsPerSample
+                    << ", \"ns_per_op_median\": " << r.nsPerOpMedian << ", \"ns_per_op_min\": " << r.nsPerOpMin
+                    << ", \"ops_per_second\": " << (r.nsPerOpMedian > 0 ? 1e9 / r.nsPerOpMedian : 0) << "}"
+                    << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    std::vector<std::size_t> parseSizes(const std::string &arg) {
+        std::vector<std::size_t> sizes;
+        std::stringstream ss(arg);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            long long v = std::stoll(item);
+            if (v <= 0) throw GameException("Dimensiune invalida: " + item);
+            sizes.push_back(static_cast<std::size_t>(v));
+        }
+        return sizes;
+    }
+
+    void printUsage(const char *prog) {
+        std::cerr << "Utilizare: " << prog
+                << " [--out fisier.json] [--sizes 10,100,...] [--min-time secunde] [--filter text]"
+                   " [--replay jurnal]\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    BenchConfig cfg;
+    std::string outPath;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--out" && i + 1 < argc) {
+                outPath = argv[++i];
+            } else if (arg == "--sizes" && i + 1 < argc) {
+                cfg.sizes = parseSizes(argv[++i]);
+            } else if (arg == "--min-time" && i + 1 < argc) {
+                cfg.minTime = std::stod(argv[++i]);
+            } else if (arg == "--filter" && i + 1 < argc) {
+                cfg.filter = argv[++i];
+            } else if (arg == "--replay" && i + 1 < argc) {
+                cfg.replayPath = argv[++i];
+            } else {
+                printUsage(argv[0]);
+                return 2;
+            }
+        }
+
+        std::vector<BenchResult> results;
+        for (std::size_t n: cfg.sizes) {
+            std::cerr << "[bench] " << n << " provinces\n";
+            runSizeBenchmarks(n, cfg, results);
+        }
+        if (!cfg.replayPath.empty()) {
+            std::cerr << "[bench] replay " << cfg.replayPath << "\n";
+            runReplayBenchmark(cfg, results);
+        }
+
+        std::ofstream file;
+        if (!outPath.empty()) {
+            file.open(outPath);
+            if (!file) throw GameException("Nu se poate deschide fisierul " + outPath);
+        }
+        writeJson(file.is_open() ? file : std::cout, results);
+    } catch (const GameException &e) {
+        std::cerr << "Game Error: " << e.what() << "\n";
+        return 1;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file headless_main.cpp
+ * @brief Punct de intrare fara interfata grafica: simuleaza un numar de zile cat de repede permite
+ *        procesorul si scrie starea finala a fiecarei tari.
+ *
+ * Utilizare:
+ *  oop_headless <zile> [scenariu] [fisier_iesire] [--threads N] [--seed S] [--load snapshot] [--save snapshot] [--export-scenario fisier] [--telemetry fisier] [--replay jurnal]
+ *
+ *  - zile: numarul de zile de simulat (>= 0)
+ *  - scenariu: "default" (scenariul construit in cod), "synthetic:countries=N,provinces=M,seed=S,..."
+ *    (lume generata, vezi WorldGenerator) sau calea catre un fisier de scenariu binar
+ *  - fisier_iesire: fisierul in care se scrie starea finala (implicit stdout)
+ *  - --threads N: numarul de thread-uri pentru simularea tarilor (implicit 1, 0 = toate nucleele)
+ *  - --seed S: seed-ul generatorului aleator (implicit Engine::DEFAULT_SEED); aceeasi valoare da aceeasi simulare
+ *  - --load snapshot: porneste din starea salvata in snapshot in locul scenariului
+ *  - --save snapshot: salveaza starea finala intr-un snapshot binar
+ *  - --export-scenario fisier: scrie tarile initiale ca fisier de scenariu binar
+ *  - --telemetry fisier: scrie starea fiecarei tari dupa fiecare zi (formatul este descris in TelemetryWriter.h)
+ *  - --replay jurnal: reia o sesiune inregistrata (CommandJournal); scenariul si seed-ul sunt cele din jurnal,
+ *    iar `zile` sunt simulate dupa ziua finala a jurnalului
+ */
+
+#include "../headers/CommandJournal.h"
+#include "../headers/Engine.h"
+#include "../headers/GameExceptions.h"
+#include "../headers/Profiler.h"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Scrie starea completa a unei tari (stocuri, fabrici, coada, focus, provincii).
+     * @param os Stream-ul de iesire.
+     * @param c Tara de afisat.
+     */
+    void writeCountryState(std::ostream &os, const Country &c) {
+        os << "=== " << c.getName() << " (" << c.getIdeology() << ") ===\n";
+        os << "Resources: " << c.getResourceStockpile() << "\n";
+        os << "Equipment: " << c.getEquipment() << "\n";
+        os << "Factories: CIV=" << c.totalCiv()
+                << ", MIL=" << c.totalMil()
+                << ", FREE_MIL=" << c.getFreeMilFactories() << "\n";
+        os << "Production lines: " << c.getProductionLines().size() << "\n";
+        os << "Construction queue: " << c.getConstructionQueue().size() << "\n";
+        os << "Active focus: " << c.getFocusTree().getActiveFocusName() << "\n";
+        for (const auto &p: c.getProvinces()) {
+            os << "  " << p.toString(c.getParams().oilToFuel) << "\n";
+        }
+    }
+
+    void printUsage(const char *prog) {
+        std::cerr << "Utilizare: " << prog << " <zile> [scenariu] [fisier_iesire] [--threads N] [--seed S] [--load snapshot] [--save snapshot] [--export-scenario fisier] [--telemetry fisier] [--replay jurnal]\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> positional;
+    std::string threadsArg = "1";
+    std::string seedArg;
+    std::string loadPath;
+    std::string savePath;
+    std::string exportPath;
+    std::string telemetryPath;
+    std::string replayPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            threadsArg = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seedArg = argv[++i];
+        } else if (arg == "--load" && i + 1 < argc) {
+            loadPath = argv[++i];
+        } else if (arg == "--save" && i + 1 < argc) {
+            savePath = argv[++i];
+        } else if (arg == "--export-scenario" && i + 1 < argc) {
+            exportPath = argv[++i];
+        } else if (arg == "--telemetry" && i + 1 < argc) {
+            telemetryPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else {
+            positional.push_back(arg);
+        }
+    }
+    if (positional.empty()) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    try {
+        int days = std::stoi(positional[0]);
+        int threads = std::stoi(threadsArg);
+        if (days < 0 || threads < 0) {
+            printUsage(argv[0]);
+            return 2;
+        }
+        std::string scenario = positional.size() >= 2 ? positional[1] : "default";
+
+        std::uint64_t seed = seedArg.empty() ? Engine::DEFAULT_SEED : std::stoull(seedArg);
+
+        std::optional<CommandJournal> replay;
+        if (!replayPath.empty()) {
+            replay = CommandJournal::load(replayPath);
+            scenario = replay->getScenario();
+            seed = replay->getSeed();
+        }
+
+        Engine engine(scenario, seed);
+        if (!loadPath.empty()) engine.loadSnapshot(loadPath);
+        if (!exportPath.empty()) engine.exportScenario(exportPath);
+        engine.setWorkerCount(static_cast<unsigned>(threads));
+
+        // rularile batch vor seria completa, deci simularea asteapta writer-ul daca acesta ramane in urma
+        std::unique_ptr<TelemetryWriter> telemetry;
+        if (!telemetryPath.empty()) {
+            telemetry = std::make_unique<TelemetryWriter>(telemetryPath, TelemetryOverflow::Wait);
+            engine.setTelemetry(telemetry.get());
+        }
+
+        int firstDay = engine.getDay();
+        auto start = std::chrono::steady_clock::now();
+        std::size_t rejected = replay ? replay->replay(engine) : 0;
+        engine.advance(days);
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (telemetry) {
+            engine.setTelemetry(nullptr);
+            telemetry->close();
+        }
+
+        if (!savePath.empty()) engine.saveSnapshot(savePath);
+
+        std::ofstream file;
+        if (positional.size() >= 3) {
+            file.open(positional[2]);
+            if (!file) throw GameException("Nu se poate deschide fisierul " + positional[2]);
+        }
+        std::ostream &out = file.is_open() ? file : std::cout;
+
+        out << "Day: " << engine.getDay() << "\n";
+        for (const auto &c: engine.getCountries()) {
+            writeCountryState(out, c);
+        }
+
+        int simulated = engine.getDay() - firstDay;
+        std::cerr << "Simulated " << simulated << " days in " << elapsed << " s";
+        if (elapsed > 0) std::cerr << " (" << static_cast<long long>(simulated / elapsed) << " days/s)";
+        std::cerr << "\n";
+        if (rejected > 0) std::cerr << "Replay: " << rejected << " comenzi refuzate si ignorate (reluarea difera de sesiunea inregistrata)\n";
+        if constexpr (Profiler::ENABLED) Profiler::dump(std::cerr);
+    } catch (const GameException &e) {
+        std::cerr << "Game Error: " << e.what() << "\n";
+        return 1;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
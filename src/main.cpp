@@ -1,13 +1,39 @@
+#include "../headers/CommandJournal.h"
 #include "../headers/Engine.h"
 #include "../headers/Interface.h"
 #include "../headers/GameExceptions.h"
+#include "../headers/Profiler.h"
 #include <iostream>
+#include <string>
+
+// oop [--record jurnal]: cu --record, comenzile jucatorului sunt salvate la iesire intr-un jurnal
+// care poate fi reluat cu `oop_headless 0 --replay jurnal`
+int main(int argc, char **argv) {
+    std::string recordPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else {
+            std::cerr << "Utilizare: " << argv[0] << " [--record jurnal]\n";
+            return 2;
+        }
+    }
 
-int main() {
     try {
         Engine engine;
-        Interface ui(engine);
-        ui.run();
+        CommandJournal journal(engine.getScenario(), engine.getSeed(), engine.getDay());
+        if (!recordPath.empty()) engine.setJournal(&journal);
+        {
+            Interface ui(engine);
+            ui.run();
+        }
+        if (!recordPath.empty()) {
+            engine.setJournal(nullptr);
+            journal.setEndDay(engine.getDay());
+            journal.save(recordPath);
+        }
+        if constexpr (Profiler::ENABLED) Profiler::dump(std::cerr);
     } catch (const AssetLoadException &e) {
         std::cerr << "Asset Error: " << e.what() << "\n";
         return 1;
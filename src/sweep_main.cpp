@@ -0,0 +1,131 @@
+/**
+ * @file sweep_main.cpp
+ * @brief Explorarea parametrilor de echilibru: aceeasi simulare rulata pe o grila de parametri si mai multe
+ *        seed-uri, pe toate nucleele, cu distributia rezultatelor in format JSON.
+ *
+ * Utilizare:
+ *  oop_sweep <zile> [scenariu] [--grid cheie=v1,v2,...]... [--seeds 1,2,3 | 1-100] [--threads N] [--out fisier.json]
+ *
+ *  - zile: ziua la care sunt masurate stocurile fiecarei rulari
+ *  - scenariu: ca la oop_headless ("default", "synthetic:..." sau un fisier de scenariu)
+ *  - --grid: o axa a grilei (poate fi repetat); cheile sunt cele din SimulationParams::set,
+ *    de ex. milOutput, civOutputPerDay, cost.mil, limit.civ, focus.0
+ *  - --seeds: seed-urile rulate pentru fiecare punct din grila (implicit Engine::DEFAULT_SEED); fiecare seed
+ *    genereaza alta lume sintetica, deci mai multe seed-uri cer un scenariu "synthetic:" fara cheia seed
+ *  - --threads: numarul de simulari rulate simultan (implicit 0 = toate nucleele)
+ *  - --out: fisierul JSON cu rezultatele (implicit stdout)
+ *
+ * Pentru fiecare punct din grila si fiecare metrica (fuel, fabrici, echipament, insumate pe toate tarile)
+ * se raporteaza media, minimul, percentilele 10/50/90 si maximul peste seed-uri.
+ */
+
+#include "../headers/ParameterSweep.h"
+#include "../headers/GameExceptions.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    std::string jsonEscape(const std::string &s) {
+        std::string r;
+        for (char ch: s) {
+            if (ch == '"' || ch == '\\') r += '\\';
+            r += ch;
+        }
+        return r;
+    }
+
+    void writeJson(std::ostream &os, const SweepConfig &cfg, const SweepResult &result) {
+        // stocurile depasesc usor 6 cifre semnificative (precizia implicita)
+        os << std::setprecision(15);
+        os << "{\n  \"format_version\": 1,\n";
+        os << "  \"scenario\": \"" << jsonEscape(cfg.scenario) << "\",\n";
+        os << "  \"days\": " << cfg.days << ",\n";
+        os << "  \"seeds\": " << cfg.seeds.size() << ",\n";
+        os << "  \"runs\": " << result.runs << ",\n";
+        os << "  \"threads\": " << result.workers << ",\n";
+        os << "  \"seconds\": " << result.seconds << ",\n";
+        os << "  \"points\": [\n";
+        for (std::size_t p = 0; p < result.points.size(); ++p) {
+            const auto &point = result.points[p];
+            os << "    {\"params\": {";
+            for (std::size_t a = 0; a < cfg.axes.size(); ++a) {
+                os << (a ? ", " : "") << "\"" << jsonEscape(cfg.axes[a].key) << "\": \""
+                        << jsonEscape(point.values[a]) << "\"";
+            }
+            os << "},\n     \"metrics\": {\n";
+            for (std::size_t m = 0; m < SWEEP_METRIC_COUNT; ++m) {
+                const auto &s = point.stats[m];
+                os << "       \"" << ParameterSweep::metricName(m) << "\": {\"mean\": " << s.mean
+                        << ", \"min\": " << s.min << ", \"p10\": " << s.p10 << ", \"p50\": " << s.p50
+                        << ", \"p90\": " << s.p90 << ", \"max\": " << s.max << "}"
+                        << (m + 1 < SWEEP_METRIC_COUNT ? ",\n" : "\n");
+            }
+            os << "     }}" << (p + 1 < result.points.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    void printUsage(const char *prog) {
+        std::cerr << "Utilizare: " << prog
+                << " <zile> [scenariu] [--grid cheie=v1,v2,...]... [--seeds 1,2,3 | 1-100] [--threads N]"
+                   " [--out fisier.json]\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    SweepConfig cfg;
+    std::string outPath;
+    std::vector<std::string> positional;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--grid" && i + 1 < argc) {
+                cfg.axes.push_back(ParameterSweep::parseAxis(argv[++i]));
+            } else if (arg == "--seeds" && i + 1 < argc) {
+                cfg.seeds = ParameterSweep::parseSeeds(argv[++i]);
+            } else if (arg == "--threads" && i + 1 < argc) {
+                int threads = std::stoi(argv[++i]);
+                if (threads < 0) {
+                    printUsage(argv[0]);
+                    return 2;
+                }
+                cfg.workers = static_cast<unsigned>(threads);
+            } else if (arg == "--out" && i + 1 < argc) {
+                outPath = argv[++i];
+            } else if (arg.starts_with("--")) {
+                printUsage(argv[0]);
+                return 2;
+            } else {
+                positional.push_back(arg);
+            }
+        }
+        if (positional.empty() || positional.size() > 2) {
+            printUsage(argv[0]);
+            return 2;
+        }
+        cfg.days = std::stoi(positional[0]);
+        if (positional.size() == 2) cfg.scenario = positional[1];
+
+        SweepResult result = ParameterSweep::run(cfg);
+
+        std::cerr << "[sweep] " << result.runs << " runs x " << cfg.days << " days on " << result.workers
+                << " threads in " << result.seconds << " s\n";
+
+        std::ofstream file;
+        if (!outPath.empty()) {
+            file.open(outPath);
+            if (!file) throw GameException("Nu se poate deschide fisierul " + outPath);
+        }
+        writeJson(file.is_open() ? file : std::cout, cfg, result);
+    } catch (const GameException &e) {
+        std::cerr << "Game Error: " << e.what() << "\n";
+        return 1;
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file allocation_test.cpp
+ * @brief Verifica faptul ca mutarea provinciilor in Country si cresterea unui std::vector<Country> nu fac
+ *        alocari per provincie.
+ *
+ * Toate alocarile programului trec prin operatorii new de mai jos, care le numara. Fiecare test masoara
+ * acelasi pas pentru o tara mica (10 provincii) si una mare (5000): o alocare per provincie ar insemna
+ * cel putin 4990 de alocari in plus. Cresterea vectorului trebuie sa faca exact aceleasi alocari; la
+ * build() arena tarii (CountryArena) cere blocuri de dimensiune crescatoare (geometric), deci o tara mare
+ * poate face cateva alocari in plus, limitate de BUILD_BLOCK_SLACK.
+ */
+
+#include "../headers/CountryBuilder.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+    std::atomic<std::size_t> allocations{0};
+
+    void *countedAlloc(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        if (void *p = std::malloc(size == 0 ? 1 : size)) return p;
+        throw std::bad_alloc();
+    }
+
+    void *countedAlignedAlloc(std::size_t size, std::align_val_t align) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        auto a = static_cast<std::size_t>(align);
+#ifdef _WIN32
+        void *p = _aligned_malloc(size == 0 ? 1 : size, a);
+#else
+        // aligned_alloc cere o dimensiune multiplu de aliniere
+        std::size_t rounded = size == 0 ? a : (size + a - 1) / a * a;
+        void *p = std::aligned_alloc(a, rounded);
+#endif
+        if (p) return p;
+        throw std::bad_alloc();
+    }
+
+    void alignedFree(void *p) noexcept {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+void *operator new(std::size_t size) { return countedAlloc(size); }
+void *operator new[](std::size_t size) { return countedAlloc(size); }
+void *operator new(std::size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+void *operator new[](std::size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+
+namespace {
+    constexpr int SMALL = 10;
+    constexpr int LARGE = 5000;
+    constexpr std::size_t BUILD_BLOCK_SLACK = 16;
+
+    CountryBuilder makeBuilder(int provinces) {
+        CountryBuilder builder;
+        builder.setName("Country").setIdeology("Democratic").setStockpile(0, 100)
+                .reserveProvinces(static_cast<std::size_t>(provinces));
+        for (int i = 0; i < provinces; ++i) {
+            // nume mai lungi decat bufferul intern al std::string: o copiere a provinciei ar aloca
+            builder.emplaceProvince("Province number " + std::to_string(i), 1000 + i, i % 4, i % 3, 1 + i % 5,
+                                    i % 6, i % 4, i % 5, i % 3, i % 4);
+        }
+        return builder;
+    }
+
+    // alocarile facute de std::move(builder).build() pentru o tara cu `provinces` provincii
+    std::size_t buildAllocations(int provinces) {
+        CountryBuilder builder = makeBuilder(provinces);
+        std::size_t before = allocations.load();
+        Country country = std::move(builder).build();
+        std::size_t used = allocations.load() - before;
+        if (country.getProvinces().size() != static_cast<std::size_t>(provinces)) return ~std::size_t{0};
+        return used;
+    }
+
+    // alocarile facute de realocarile unui std::vector<Country> cu `count` tari de cate `provinces` provincii
+    std::size_t growthAllocations(int count, int provinces) {
+        std::vector<Country> pending;
+        pending.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) pending.push_back(makeBuilder(provinces).build());
+
+        std::vector<Country> world;
+        std::size_t before = allocations.load();
+        for (auto &c: pending) world.push_back(std::move(c));
+        return allocations.load() - before;
+    }
+}
+
+int main() {
+    int failures = 0;
+    auto check = [&failures](const char *what, std::size_t small, std::size_t large, std::size_t slack) {
+        std::cout << what << ": " << small << " alocari (" << SMALL << " provincii), " << large
+                << " alocari (" << LARGE << " provincii)\n";
+        if (large > small + slack || small > large) {
+            std::cout << "  EROARE: numarul de alocari depinde de numarul de provincii\n";
+            ++failures;
+        }
+    };
+
+    check("std::move(builder).build()", buildAllocations(SMALL), buildAllocations(LARGE), BUILD_BLOCK_SLACK);
+    check("std::vector<Country> growth", growthAllocations(64, SMALL), growthAllocations(64, LARGE), 0);
+
+    return failures == 0 ? 0 : 1;
+}